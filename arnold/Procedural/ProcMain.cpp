@@ -271,8 +271,14 @@ int ProcInit( struct AtNode *node, void **user_ptr )
         return 1;
     }
 
+    // many procedurals usually point at the same file, share it between them
     Alembic::AbcCoreFactory::IFactory factory;
     factory.setPolicy(ErrorHandler::kQuietNoopPolicy);
+    factory.setUseSharedArchives( true );
+
+    // and each of them walks down from the top again, so keep the headers
+    // of the objects they've been through
+    factory.setOgawaRetainedReaderCount( 4096 );
     IArchive archive = factory.getArchive( args->filename );
 
     IObject root = archive.getTop();
@@ -46,9 +46,13 @@
 #include <Alembic/Abc/Argument.h>
 #include <Alembic/Abc/IArchive.h>
 #include <Alembic/Abc/IArrayProperty.h>
+#include <Alembic/Abc/IArrayReadGroup.h>
 #include <Alembic/Abc/IBaseProperty.h>
 #include <Alembic/Abc/ICompoundProperty.h>
+#include <Alembic/Abc/IFrameContext.h>
+#include <Alembic/Abc/IHierarchyVisitor.h>
 #include <Alembic/Abc/IObject.h>
+#include <Alembic/Abc/IPlaybackCursor.h>
 #include <Alembic/Abc/ISampleSelector.h>
 #include <Alembic/Abc/IScalarProperty.h>
 #include <Alembic/Abc/ISchema.h>
@@ -75,6 +75,49 @@ IObject IArchive::getTop() const
     return IObject();
 }
 
+//-*****************************************************************************
+IObject IArchive::getObject( const std::string &iFullName ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getObject()" );
+
+    AbcA::ObjectReaderPtr ptr = m_archive->getObject( iFullName );
+    if ( ptr )
+    {
+        return IObject( ptr );
+    }
+
+    // instances only exist at the Abc level, so a path through one has to
+    // be walked one child at a time
+    IObject obj = IObject( m_archive->getTop() );
+
+    std::size_t start = 0;
+    while ( obj.valid() && start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            obj = obj.getChild( iFullName.substr( start, end - start ) );
+        }
+
+        start = end + 1;
+    }
+
+    if ( obj.valid() )
+    {
+        return obj;
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return IObject();
+}
+
 //-*****************************************************************************
 AbcA::ReadArraySampleCachePtr IArchive::getReadArraySampleCachePtr()
 {
@@ -129,6 +129,12 @@ public:
     //! automatically as part of the archive.
     IObject getTop() const;
 
+    //! Returns the object at the given full path, such as "/a/b/c", without
+    //! having to get each of its parents with IObject::getChild.  Paths
+    //! that go through instances are followed too.  If there is no object
+    //! at that path an invalid IObject is returned.
+    IObject getObject( const std::string &iFullName ) const;
+
     //! Get the read array sample cache. It may be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will be disabled if a NULL cache is returned here.
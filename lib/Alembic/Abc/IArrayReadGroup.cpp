@@ -0,0 +1,348 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/IArrayReadGroup.h>
+
+#if !defined( ALEMBIC_LIB_USES_TR1 ) && __cplusplus >= 201103L
+#define ALEMBIC_ABC_PARALLEL_READ
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+#ifdef ALEMBIC_ABC_PARALLEL_READ
+
+//-*****************************************************************************
+// Every thread takes the next read that nobody has started yet, so a thread
+// stuck on a big read doesn't hold up the small ones.
+class ArrayReadWorker
+{
+public:
+    ArrayReadWorker( IArrayReadGroup & iGroup )
+      : m_group( iGroup )
+      , m_next( 0 )
+    {
+    }
+
+    void operator()()
+    {
+        size_t numReads = m_group.m_reads.size();
+        for ( size_t i = m_next++; i < numReads; i = m_next++ )
+        {
+            try
+            {
+                m_group.doRead( i );
+            }
+            catch ( ... )
+            {
+                std::lock_guard< std::mutex > l( m_errorLock );
+                if ( !m_error )
+                {
+                    m_error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void rethrow()
+    {
+        if ( m_error )
+        {
+            std::rethrow_exception( m_error );
+        }
+    }
+
+private:
+    IArrayReadGroup & m_group;
+    std::atomic< size_t > m_next;
+    std::mutex m_errorLock;
+    std::exception_ptr m_error;
+};
+
+//-*****************************************************************************
+// Threads which sleep between calls to IArrayReadGroup::read, so that
+// reading a group every frame doesn't start and join threads every frame.
+class ArrayReadPool
+{
+public:
+    ArrayReadPool( size_t iNumThreads )
+      : m_worker( NULL )
+      , m_generation( 0 )
+      , m_busy( 0 )
+      , m_stop( false )
+    {
+        for ( size_t i = 0; i < iNumThreads; ++i )
+        {
+            m_threads.push_back( std::thread( &ArrayReadPool::work, this ) );
+        }
+    }
+
+    ~ArrayReadPool()
+    {
+        {
+            std::lock_guard< std::mutex > l( m_lock );
+            m_stop = true;
+        }
+        m_wake.notify_all();
+
+        for ( size_t i = 0; i < m_threads.size(); ++i )
+        {
+            m_threads[i].join();
+        }
+    }
+
+    // does iWorker on every pool thread and the calling thread, and returns
+    // once they are all done with it
+    void run( ArrayReadWorker & iWorker )
+    {
+        {
+            std::lock_guard< std::mutex > l( m_lock );
+            m_worker = &iWorker;
+            m_busy = m_threads.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        iWorker();
+
+        std::unique_lock< std::mutex > l( m_lock );
+        while ( m_busy > 0 )
+        {
+            m_done.wait( l );
+        }
+        m_worker = NULL;
+    }
+
+private:
+    void work()
+    {
+        size_t generation = 0;
+        std::unique_lock< std::mutex > l( m_lock );
+        for ( ;; )
+        {
+            while ( !m_stop && m_generation == generation )
+            {
+                m_wake.wait( l );
+            }
+
+            if ( m_stop )
+            {
+                return;
+            }
+
+            generation = m_generation;
+            ArrayReadWorker * worker = m_worker;
+
+            l.unlock();
+            ( *worker )();
+            l.lock();
+
+            if ( --m_busy == 0 )
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    std::vector< std::thread > m_threads;
+
+    std::mutex m_lock;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    ArrayReadWorker * m_worker;
+    size_t m_generation;
+    size_t m_busy;
+    bool m_stop;
+};
+
+#endif
+
+//-*****************************************************************************
+IArrayReadGroup::IArrayReadGroup( size_t iNumThreads )
+  : m_numThreads( iNumThreads )
+  , m_minParallelReads( 2 )
+  , m_pool( NULL )
+{
+#ifdef ALEMBIC_ABC_PARALLEL_READ
+    if ( m_numThreads == 0 )
+    {
+        m_numThreads = std::thread::hardware_concurrency();
+    }
+
+    if ( m_numThreads == 0 )
+    {
+        m_numThreads = 1;
+    }
+#else
+    m_numThreads = 1;
+#endif
+}
+
+//-*****************************************************************************
+IArrayReadGroup::~IArrayReadGroup()
+{
+#ifdef ALEMBIC_ABC_PARALLEL_READ
+    delete m_pool;
+#endif
+}
+
+//-*****************************************************************************
+void IArrayReadGroup::assignUntyped( const AbcA::ArraySamplePtr & iSample,
+                                     void * oSample )
+{
+    *static_cast< AbcA::ArraySamplePtr * >( oSample ) = iSample;
+}
+
+//-*****************************************************************************
+void IArrayReadGroup::add( const IArrayProperty & iProp,
+                           AbcA::ArraySamplePtr & oSample,
+                           const ISampleSelector & iSS )
+{
+    addRead( iProp, iSS, &oSample, &IArrayReadGroup::assignUntyped );
+}
+
+//-*****************************************************************************
+void IArrayReadGroup::addRead( const IArrayProperty & iProp,
+                               const ISampleSelector & iSS,
+                               void * oSample, AssignFunc iAssign )
+{
+    if ( !iProp.valid() || iProp.getNumSamples() == 0 )
+    {
+        return;
+    }
+
+    // the index gets worked out here so the reads don't need the selector,
+    // which might be using a frame context that isn't safe to share
+    Read r;
+    r.prop = iProp;
+    r.index = iSS.getIndex( iProp.getTimeSampling(), iProp.getNumSamples() );
+    r.output = oSample;
+    r.assign = iAssign;
+    m_reads.push_back( r );
+}
+
+//-*****************************************************************************
+void IArrayReadGroup::addFinisher( FinisherPtr iFinisher )
+{
+    if ( iFinisher )
+    {
+        m_finishers.push_back( iFinisher );
+    }
+}
+
+//-*****************************************************************************
+void IArrayReadGroup::doRead( size_t iIndex )
+{
+    Read & r = m_reads[iIndex];
+    AbcA::ArraySamplePtr samp;
+    r.prop.get( samp, ISampleSelector( r.index ) );
+    r.assign( samp, r.output );
+}
+
+//-*****************************************************************************
+void IArrayReadGroup::read()
+{
+    // taken now so the group is empty even if a read throws
+    std::vector< FinisherPtr > finishers;
+    finishers.swap( m_finishers );
+
+#ifdef ALEMBIC_ABC_PARALLEL_READ
+    // either way, everything still gets read before the first error is
+    // rethrown
+    ArrayReadWorker worker( *this );
+
+    if ( m_numThreads > 1 && m_reads.size() >= m_minParallelReads &&
+         m_reads.size() > 1 )
+    {
+        if ( !m_pool )
+        {
+            m_pool = new ArrayReadPool( m_numThreads - 1 );
+        }
+
+        m_pool->run( worker );
+    }
+    else
+    {
+        worker();
+    }
+
+    m_reads.clear();
+    worker.rethrow();
+#else
+    // without std::exception_ptr only the message of the first error can be
+    // kept, everything still gets read before it is thrown
+    bool failed = false;
+    std::string error;
+    for ( size_t i = 0; i < m_reads.size(); ++i )
+    {
+        try
+        {
+            doRead( i );
+        }
+        catch ( std::exception & e )
+        {
+            if ( !failed )
+            {
+                failed = true;
+                error = e.what();
+            }
+        }
+    }
+
+    m_reads.clear();
+
+    if ( failed )
+    {
+        ABCA_THROW( error );
+    }
+#endif
+
+    for ( size_t i = 0; i < finishers.size(); ++i )
+    {
+        finishers[i]->finish();
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,174 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_IArrayReadGroup_h_
+#define _Alembic_Abc_IArrayReadGroup_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/IArrayProperty.h>
+#include <Alembic/Abc/ITypedArrayProperty.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+class ArrayReadPool;
+
+//-*****************************************************************************
+//! Collects array property reads so they can all be issued at once instead
+//! of one after another.  add only works out which sample is wanted, the
+//! data is read by read(), which spreads the reads over several threads and
+//! returns once every output sample pointer has been filled in.  The threads
+//! are started by the first read() that needs them and are kept until the
+//! group is destroyed, so a group should be reused from frame to frame.
+//! Fewer reads than getMinParallelReads() are done on the calling thread.
+//!
+//! The schemas use this to fetch all of their array properties together,
+//! and reads for many objects can be queued up in the same group.  The
+//! outputs passed to add must stay alive until read() returns.
+//!
+//! Ogawa archives can only read as many things at once as the number of
+//! streams they were opened with.  HDF5 archives should only be read with
+//! 1 thread.  When built without C++11 threads everything is read on the
+//! calling thread.
+class ALEMBIC_EXPORT IArrayReadGroup : Alembic::Util::noncopyable
+{
+public:
+    //! iNumThreads of 0 uses as many threads as there are cores, counting
+    //! the thread that calls read().
+    explicit IArrayReadGroup( size_t iNumThreads = 0 );
+
+    ~IArrayReadGroup();
+
+    size_t getNumThreads() const { return m_numThreads; }
+
+    //! read() only uses the other threads when at least this many reads are
+    //! queued.  The default of 2 spreads even a single mesh's reads, which
+    //! helps when every read waits on remote storage.  For local archives,
+    //! where small reads are cheaper than waking the threads, raise it.
+    void setMinParallelReads( size_t iMinReads )
+    { m_minParallelReads = iMinReads; }
+
+    size_t getMinParallelReads() const { return m_minParallelReads; }
+
+    //! The number of reads waiting for read()
+    size_t getNumReads() const { return m_reads.size(); }
+
+    //! Queues a read of iProp into oSample, does nothing if iProp is invalid
+    //! or has no samples.
+    void add( const IArrayProperty & iProp,
+              AbcA::ArraySamplePtr & oSample,
+              const ISampleSelector & iSS = ISampleSelector() );
+
+    template <class TRAITS>
+    void add( const ITypedArrayProperty<TRAITS> & iProp,
+              Alembic::Util::shared_ptr< TypedArraySample<TRAITS> > & oSample,
+              const ISampleSelector & iSS = ISampleSelector() )
+    {
+        addRead( iProp, iSS, &oSample, &assignTyped<TRAITS> );
+    }
+
+    //! Something to do with the outputs once they have all been read, the
+    //! schemas use these to cache what they read.
+    class Finisher
+    {
+    public:
+        virtual ~Finisher() {}
+        virtual void finish() = 0;
+    };
+
+    typedef Alembic::Util::shared_ptr< Finisher > FinisherPtr;
+
+    //! Queues iFinisher to be run by read() on the calling thread, in the
+    //! order they were added, once every read has succeeded.
+    void addFinisher( FinisherPtr iFinisher );
+
+    //! Does all of the queued reads and empties the group.  If any of the
+    //! reads throw, the first exception is rethrown unchanged once the others
+    //! have finished, the outputs of the reads that succeeded are still set
+    //! but no finishers are run.
+    void read();
+
+private:
+    typedef void ( *AssignFunc )( const AbcA::ArraySamplePtr &, void * );
+
+    template <class TRAITS>
+    static void assignTyped( const AbcA::ArraySamplePtr & iSample,
+                             void * oSample )
+    {
+        *static_cast< Alembic::Util::shared_ptr< TypedArraySample<TRAITS> > *>(
+            oSample ) = Alembic::Util::static_pointer_cast<
+                TypedArraySample<TRAITS>, AbcA::ArraySample>( iSample );
+    }
+
+    static void assignUntyped( const AbcA::ArraySamplePtr & iSample,
+                               void * oSample );
+
+    void addRead( const IArrayProperty & iProp, const ISampleSelector & iSS,
+                  void * oSample, AssignFunc iAssign );
+
+    struct Read
+    {
+        IArrayProperty prop;
+        index_t index;
+        void * output;
+        AssignFunc assign;
+    };
+
+    friend class ArrayReadWorker;
+    friend class ArrayReadPool;
+
+    // does the read at iIndex, and assigns its output
+    void doRead( size_t iIndex );
+
+    size_t m_numThreads;
+    size_t m_minParallelReads;
+    std::vector< Read > m_reads;
+    std::vector< FinisherPtr > m_finishers;
+
+    // the threads that help read(), NULL until they are first needed
+    ArrayReadPool * m_pool;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
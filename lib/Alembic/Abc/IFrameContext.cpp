@@ -0,0 +1,204 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/IFrameContext.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+IFrameContext::IFrameContext( chrono_t iTime,
+                              ISampleSelector::TimeIndexType iTimeIndexType )
+  : m_time( iTime )
+  , m_timeIndexType( iTimeIndexType )
+  , m_numCached( 0 )
+{
+    for ( size_t i = 0; i < kNumBuckets; ++i )
+    {
+#ifdef ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+        m_buckets[i].store( NULL, std::memory_order_relaxed );
+#else
+        m_buckets[i] = NULL;
+#endif
+    }
+}
+
+//-*****************************************************************************
+IFrameContext::~IFrameContext()
+{
+    for ( size_t i = 0; i < kNumBuckets; ++i )
+    {
+#ifdef ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+        CacheEntry * entry = m_buckets[i].load( std::memory_order_relaxed );
+#else
+        CacheEntry * entry = m_buckets[i];
+#endif
+        while ( entry )
+        {
+            CacheEntry * next = entry->next;
+            delete entry;
+            entry = next;
+        }
+    }
+}
+
+//-*****************************************************************************
+size_t IFrameContext::getBucket( const AbcA::TimeSampling * iTsmp,
+                                 index_t iNumSamples )
+{
+    // the low bits of the address are the same for every TimeSampling
+    size_t h = reinterpret_cast< size_t >( iTsmp ) >> 4;
+    h ^= static_cast< size_t >( iNumSamples ) * 31;
+    return h % kNumBuckets;
+}
+
+//-*****************************************************************************
+const IFrameContext::CacheEntry *
+IFrameContext::find( size_t iBucket, const AbcA::TimeSampling * iTsmp,
+                     index_t iNumSamples ) const
+{
+#ifdef ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+    const CacheEntry * entry =
+        m_buckets[iBucket].load( std::memory_order_acquire );
+#else
+    const CacheEntry * entry = m_buckets[iBucket];
+#endif
+
+    for ( ; entry; entry = entry->next )
+    {
+        if ( entry->timeSampling.get() == iTsmp &&
+             entry->numSamples == iNumSamples )
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+//-*****************************************************************************
+index_t IFrameContext::computeIndex( const AbcA::TimeSamplingPtr & iTsmp,
+                                     index_t iNumSamples ) const
+{
+    index_t retIdx;
+
+    if ( m_timeIndexType == ISampleSelector::kNearIndex )
+    {
+        retIdx = iTsmp->getNearIndex( m_time, iNumSamples ).first;
+    }
+    else if ( m_timeIndexType == ISampleSelector::kFloorIndex )
+    {
+        retIdx = iTsmp->getFloorIndex( m_time, iNumSamples ).first;
+    }
+    else
+    {
+        assert( m_timeIndexType == ISampleSelector::kCeilIndex );
+        retIdx = iTsmp->getCeilIndex( m_time, iNumSamples ).first;
+    }
+
+    return retIdx < 0 ? 0 : ( retIdx < iNumSamples ? retIdx : iNumSamples-1 );
+}
+
+//-*****************************************************************************
+index_t IFrameContext::getIndex( const AbcA::TimeSamplingPtr & iTsmp,
+                                 index_t iNumSamples )
+{
+    // uniform sampling is just arithmetic, cheaper than looking it up
+    if ( iNumSamples < 2 ||
+         iTsmp->getTimeSamplingType().isUniform() )
+    {
+        return computeIndex( iTsmp, iNumSamples );
+    }
+
+    size_t bucket = getBucket( iTsmp.get(), iNumSamples );
+
+#ifdef ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+    const CacheEntry * found = find( bucket, iTsmp.get(), iNumSamples );
+    if ( found )
+    {
+        return found->index;
+    }
+#else
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        const CacheEntry * found = find( bucket, iTsmp.get(), iNumSamples );
+        if ( found )
+        {
+            return found->index;
+        }
+    }
+#endif
+
+    // search outside of the lock, if two threads race here they compute the
+    // same answer
+    index_t index = computeIndex( iTsmp, iNumSamples );
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    // only one of the racing threads adds it
+    if ( find( bucket, iTsmp.get(), iNumSamples ) )
+    {
+        return index;
+    }
+
+    CacheEntry * entry = new CacheEntry;
+    entry->timeSampling = iTsmp;
+    entry->numSamples = iNumSamples;
+    entry->index = index;
+
+#ifdef ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+    entry->next = m_buckets[bucket].load( std::memory_order_relaxed );
+    m_buckets[bucket].store( entry, std::memory_order_release );
+#else
+    entry->next = m_buckets[bucket];
+    m_buckets[bucket] = entry;
+#endif
+
+    ++m_numCached;
+    return index;
+}
+
+//-*****************************************************************************
+size_t IFrameContext::getNumCachedIndices()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_numCached;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,133 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+#ifndef _Alembic_Abc_IFrameContext_h_
+#define _Alembic_Abc_IFrameContext_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/ISampleSelector.h>
+
+// with C++11 atomics, indices which have already been resolved are looked
+// up without taking a lock
+#if !defined(ALEMBIC_LIB_USES_TR1) && __cplusplus >= 201103L
+#define ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+#include <atomic>
+#endif
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Holds a requested time for a whole frame and remembers the index that
+//! time resolved to for every (TimeSampling, number of samples) pair it was
+//! asked about.  Most properties in an archive share a handful of
+//! TimeSamplings, so building an ISampleSelector from a frame context means
+//! the search through the sample times only happens once per TimeSampling
+//! instead of once per property.
+//!
+//! The context must outlive every ISampleSelector that was made from it.
+//! It is safe to read properties with its selectors from multiple threads,
+//! indices which have already been resolved are found without a lock.
+class ALEMBIC_EXPORT IFrameContext : Alembic::Util::noncopyable
+{
+public:
+    explicit IFrameContext( chrono_t iTime,
+        ISampleSelector::TimeIndexType iTimeIndexType =
+            ISampleSelector::kNearIndex );
+
+    ~IFrameContext();
+
+    chrono_t getTime() const { return m_time; }
+
+    ISampleSelector::TimeIndexType getTimeIndexType() const
+    { return m_timeIndexType; }
+
+    //! Returns the same index as
+    //! ISampleSelector( getTime(), getTimeIndexType() ).getIndex(...)
+    index_t getIndex( const AbcA::TimeSamplingPtr & iTsmp,
+                      index_t iNumSamples );
+
+    //! How many (TimeSampling, number of samples) pairs have been resolved
+    size_t getNumCachedIndices();
+
+private:
+    index_t computeIndex( const AbcA::TimeSamplingPtr & iTsmp,
+                          index_t iNumSamples ) const;
+
+    // Entries are only ever added, at the front of their bucket, and are
+    // never changed once they are there so they can be read while another
+    // thread is adding.
+    struct CacheEntry
+    {
+        // held so the TimeSampling can't be freed and its address reused
+        AbcA::TimeSamplingPtr timeSampling;
+        index_t numSamples;
+        index_t index;
+        CacheEntry * next;
+    };
+
+    static const size_t kNumBuckets = 64;
+
+    static size_t getBucket( const AbcA::TimeSampling * iTsmp,
+                             index_t iNumSamples );
+
+    const CacheEntry * find( size_t iBucket,
+                             const AbcA::TimeSampling * iTsmp,
+                             index_t iNumSamples ) const;
+
+    chrono_t m_time;
+    ISampleSelector::TimeIndexType m_timeIndexType;
+
+#ifdef ALEMBIC_ABC_ATOMIC_FRAME_CONTEXT
+    std::atomic< CacheEntry * > m_buckets[kNumBuckets];
+#else
+    CacheEntry * m_buckets[kNumBuckets];
+#endif
+
+    // taken to add entries, and to look them up without atomics
+    Alembic::Util::mutex m_lock;
+    size_t m_numCached;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
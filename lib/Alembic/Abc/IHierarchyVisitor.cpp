@@ -0,0 +1,293 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/IHierarchyVisitor.h>
+
+#if !defined( ALEMBIC_LIB_USES_TR1 ) && __cplusplus >= 201103L
+#define ALEMBIC_ABC_PARALLEL_VISIT
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+#ifdef ALEMBIC_ABC_PARALLEL_VISIT
+
+//-*****************************************************************************
+// The shared state of one traversal.  Every thread owns a deque, it pushes
+// and pops its own work at the back (depth first, which keeps the queues
+// short) and steals from the front of the others (the objects nearest the
+// root, which tend to have the most work under them).  A thread that finds
+// nothing to do sleeps until more work is queued or the traversal is over.
+class HierarchyWorker
+{
+public:
+    HierarchyWorker( IHierarchyVisitor & iVisitor, size_t iNumThreads )
+      : m_visitor( iVisitor )
+      , m_queues( iNumThreads )
+      , m_pending( 0 )
+      , m_queued( 0 )
+      , m_numIdle( 0 )
+      , m_failed( false )
+    {
+    }
+
+    void push( size_t iThreadIndex, const IObject & iObject )
+    {
+        ++m_pending;
+        {
+            Queue & q = m_queues[iThreadIndex];
+            std::lock_guard< std::mutex > l( q.lock );
+            q.objects.push_back( iObject );
+        }
+        ++m_queued;
+
+        // an idle thread checks m_queued after saying it is idle, while
+        // holding m_idleLock, so taking it here means it can't miss this
+        if ( m_numIdle > 0 )
+        {
+            std::lock_guard< std::mutex > l( m_idleLock );
+            m_wake.notify_one();
+        }
+    }
+
+    void operator()( size_t iThreadIndex )
+    {
+        IObject obj;
+        while ( m_pending > 0 && !m_failed )
+        {
+            if ( !pop( iThreadIndex, obj ) && !steal( iThreadIndex, obj ) )
+            {
+                std::unique_lock< std::mutex > l( m_idleLock );
+                ++m_numIdle;
+                while ( m_queued == 0 && m_pending > 0 && !m_failed )
+                {
+                    m_wake.wait( l );
+                }
+                --m_numIdle;
+                continue;
+            }
+
+            try
+            {
+                if ( m_visitor.visit( obj, iThreadIndex ) )
+                {
+                    size_t numChildren = obj.getNumChildren();
+                    for ( size_t i = 0; i < numChildren; ++i )
+                    {
+                        push( iThreadIndex, obj.getChild( i ) );
+                    }
+                }
+            }
+            catch ( ... )
+            {
+                std::lock_guard< std::mutex > l( m_errorLock );
+                if ( !m_error )
+                {
+                    m_error = std::current_exception();
+                }
+                m_failed = true;
+            }
+
+            // only finished once the children have been queued
+            obj.reset();
+            if ( --m_pending == 0 || m_failed )
+            {
+                std::lock_guard< std::mutex > l( m_idleLock );
+                m_wake.notify_all();
+            }
+        }
+    }
+
+    void rethrow()
+    {
+        if ( m_error )
+        {
+            std::rethrow_exception( m_error );
+        }
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex lock;
+        std::deque< IObject > objects;
+    };
+
+    bool pop( size_t iThreadIndex, IObject & oObject )
+    {
+        Queue & q = m_queues[iThreadIndex];
+        std::lock_guard< std::mutex > l( q.lock );
+        if ( q.objects.empty() )
+        {
+            return false;
+        }
+        oObject = q.objects.back();
+        q.objects.pop_back();
+        --m_queued;
+        return true;
+    }
+
+    bool steal( size_t iThreadIndex, IObject & oObject )
+    {
+        size_t numQueues = m_queues.size();
+        for ( size_t i = 1; i < numQueues; ++i )
+        {
+            Queue & q = m_queues[( iThreadIndex + i ) % numQueues];
+            std::lock_guard< std::mutex > l( q.lock );
+            if ( !q.objects.empty() )
+            {
+                oObject = q.objects.front();
+                q.objects.pop_front();
+                --m_queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    IHierarchyVisitor & m_visitor;
+    std::vector< Queue > m_queues;
+
+    // objects that were queued but aren't done being visited
+    std::atomic< size_t > m_pending;
+
+    // objects sitting in the queues
+    std::atomic< size_t > m_queued;
+
+    // threads that found nothing to do wait on m_wake
+    std::atomic< size_t > m_numIdle;
+    std::mutex m_idleLock;
+    std::condition_variable m_wake;
+
+    std::atomic< bool > m_failed;
+
+    std::mutex m_errorLock;
+    std::exception_ptr m_error;
+};
+
+#endif
+
+//-*****************************************************************************
+IHierarchyVisitor::IHierarchyVisitor( size_t iNumThreads )
+  : m_numThreads( iNumThreads )
+{
+#ifdef ALEMBIC_ABC_PARALLEL_VISIT
+    if ( m_numThreads == 0 )
+    {
+        m_numThreads = std::thread::hardware_concurrency();
+    }
+
+    if ( m_numThreads == 0 )
+    {
+        m_numThreads = 1;
+    }
+#else
+    m_numThreads = 1;
+#endif
+}
+
+//-*****************************************************************************
+IHierarchyVisitor::~IHierarchyVisitor()
+{
+}
+
+//-*****************************************************************************
+void IHierarchyVisitor::traverseSerial( const IObject & iRoot )
+{
+    std::vector< IObject > stack;
+    stack.push_back( iRoot );
+    while ( !stack.empty() )
+    {
+        IObject obj = stack.back();
+        stack.pop_back();
+
+        if ( visit( obj, 0 ) )
+        {
+            // pushed in reverse so children get visited in order
+            for ( size_t i = obj.getNumChildren(); i > 0; --i )
+            {
+                stack.push_back( obj.getChild( i - 1 ) );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void IHierarchyVisitor::traverse( const IObject & iRoot )
+{
+    if ( !iRoot.valid() )
+    {
+        return;
+    }
+
+#ifdef ALEMBIC_ABC_PARALLEL_VISIT
+    if ( m_numThreads > 1 )
+    {
+        HierarchyWorker worker( *this, m_numThreads );
+        worker.push( 0, iRoot );
+
+        std::vector< std::thread > threads;
+        for ( size_t i = 1; i < m_numThreads; ++i )
+        {
+            threads.push_back( std::thread( std::ref( worker ), i ) );
+        }
+
+        worker( 0 );
+
+        for ( size_t i = 0; i < threads.size(); ++i )
+        {
+            threads[i].join();
+        }
+
+        worker.rethrow();
+        return;
+    }
+#endif
+
+    traverseSerial( iRoot );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,104 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+#ifndef _Alembic_Abc_IHierarchyVisitor_h_
+#define _Alembic_Abc_IHierarchyVisitor_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/IObject.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Walks an object hierarchy on several threads.  Subclass it and implement
+//! visit, which gets called exactly once for every object reached from the
+//! root (including the root itself) on one of the threads.  Each thread
+//! keeps its own queue of objects whose children still need visiting, and
+//! idle threads steal from the others, so unbalanced hierarchies still keep
+//! all of the threads busy.
+//!
+//! There is no ordering between objects other than a parent being visited
+//! before its children.  Per thread state can be kept in an array sized by
+//! getNumThreads() and indexed by the thread index passed to visit, which
+//! avoids any locking inside of visit.
+//!
+//! When built without C++11 threads everything is visited on the calling
+//! thread with a thread index of 0.
+class ALEMBIC_EXPORT IHierarchyVisitor
+{
+public:
+    //! iNumThreads of 0 uses as many threads as there are cores.  Ogawa
+    //! archives can only read as many things at once as the number of
+    //! streams they were opened with, so there is little point in using
+    //! many more threads than that unless visit does a lot of its own work.
+    //! HDF5 archives should be traversed with 1 thread.
+    explicit IHierarchyVisitor( size_t iNumThreads = 0 );
+
+    virtual ~IHierarchyVisitor();
+
+    //! The number of threads traverse will use, thread indices passed to
+    //! visit are less than this.
+    size_t getNumThreads() const { return m_numThreads; }
+
+    //! Visits iRoot and everything under it, returns when everything has
+    //! been visited.  If visit throws, the traversal stops and the first
+    //! exception is rethrown here.
+    void traverse( const IObject & iRoot );
+
+protected:
+    //! Called once for each object, return false to skip visiting its
+    //! children.
+    virtual bool visit( const IObject & iObject, size_t iThreadIndex ) = 0;
+
+private:
+    // the serial traversal, also used when there is only 1 thread
+    void traverseSerial( const IObject & iRoot );
+
+    friend class HierarchyWorker;
+
+    size_t m_numThreads;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -355,7 +355,7 @@ IObject IObject::getChild( const std::string &iChildName ) const
                      kWrapExisting,
                      getErrorHandlerPolicy() );
 
-        if ( !m_instancedFullName.empty() )
+        if ( obj.valid() && !m_instancedFullName.empty() )
         {
             obj.setInstancedFullName(
                 m_instancedFullName + std::string("/") + obj.getName() );
@@ -0,0 +1,190 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/IPlaybackCursor.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//! The same tolerance AbcCoreAbstract::TimeSampling uses for comparing times
+static const chrono_t kCHRONO_EPSILON = 1e-5;
+
+//! How far we walk from the last index before giving up and searching
+static const index_t kMAX_CURSOR_STEPS = 8;
+
+//-*****************************************************************************
+ITimeCursor::ITimeCursor()
+  : m_numSamples( 0 )
+  , m_acyclic( false )
+  , m_floorIndex( 0 )
+{
+}
+
+//-*****************************************************************************
+ITimeCursor::ITimeCursor( AbcA::TimeSamplingPtr iTimeSampling,
+                          index_t iNumSamples )
+  : m_timeSampling( iTimeSampling )
+  , m_numSamples( iNumSamples )
+  , m_acyclic( false )
+  , m_floorIndex( 0 )
+{
+    // uniform and cyclic sampling can already find any time directly
+    if ( m_timeSampling )
+    {
+        m_acyclic = m_timeSampling->getTimeSamplingType().isAcyclic();
+    }
+}
+
+//-*****************************************************************************
+index_t ITimeCursor::getFloorIndex( chrono_t iTime )
+{
+    if ( !m_acyclic )
+    {
+        return m_timeSampling->getFloorIndex( iTime, m_numSamples ).first;
+    }
+
+    const std::vector < chrono_t > & times =
+        m_timeSampling->getStoredTimes();
+
+    if ( iTime <= times[0] )
+    {
+        m_floorIndex = 0;
+        return 0;
+    }
+
+    if ( iTime >= times[m_numSamples - 1] )
+    {
+        m_floorIndex = m_numSamples - 1;
+        return m_floorIndex;
+    }
+
+    // times[0] < iTime < times[m_numSamples - 1], so we can always look at
+    // the samples on either side of idx
+    index_t idx = std::min( m_floorIndex, m_numSamples - 2 );
+    index_t steps = 0;
+    for ( ; steps < kMAX_CURSOR_STEPS; ++steps )
+    {
+        if ( times[idx] > iTime )
+        {
+            --idx;
+        }
+        else if ( times[idx + 1] <= iTime )
+        {
+            ++idx;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if ( steps == kMAX_CURSOR_STEPS )
+    {
+        m_floorIndex =
+            m_timeSampling->getFloorIndex( iTime, m_numSamples ).first;
+        return m_floorIndex;
+    }
+
+    m_floorIndex = idx;
+
+    // a time just short of the next sample counts as that sample
+    if ( std::fabs( iTime - times[idx + 1] ) <= kCHRONO_EPSILON )
+    {
+        ++idx;
+    }
+
+    return idx;
+}
+
+//-*****************************************************************************
+index_t ITimeCursor::getIndex( const ISampleSelector &iSS )
+{
+    if ( iSS.getRequestedIndex() >= 0 || iSS.getFrameContext() ||
+         !m_timeSampling || m_numSamples < 1 )
+    {
+        return iSS.getIndex( m_timeSampling, m_numSamples );
+    }
+
+    chrono_t time = iSS.getRequestedTime();
+    index_t maxIdx = m_numSamples - 1;
+
+    // see TimeSampling::getCeilIndex and getNearIndex
+    index_t idx = 0;
+    if ( iSS.getRequestedTimeIndexType() == ISampleSelector::kFloorIndex )
+    {
+        idx = getFloorIndex( time );
+    }
+    else if ( iSS.getRequestedTimeIndexType() == ISampleSelector::kCeilIndex )
+    {
+        if ( time <= m_timeSampling->getSampleTime( 0 ) )
+        {
+            idx = 0;
+        }
+        else if ( time >= m_timeSampling->getSampleTime( maxIdx ) )
+        {
+            idx = maxIdx;
+        }
+        else
+        {
+            idx = getFloorIndex( time );
+            if ( idx < maxIdx && std::fabs( time -
+                 m_timeSampling->getSampleTime( idx ) ) > kCHRONO_EPSILON )
+            {
+                ++idx;
+            }
+        }
+    }
+    else
+    {
+        idx = getFloorIndex( time );
+        if ( idx < maxIdx &&
+             std::fabs( time - m_timeSampling->getSampleTime( idx ) ) >
+             std::fabs( m_timeSampling->getSampleTime( idx + 1 ) - time ) )
+        {
+            ++idx;
+        }
+    }
+
+    return idx < 0 ? 0 : ( idx < m_numSamples ? idx : m_numSamples - 1 );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,186 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Abc_IPlaybackCursor_h_
+#define _Alembic_Abc_IPlaybackCursor_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/ISampleSelector.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Resolves sample selectors to indices the same way
+//! ISampleSelector::getIndex does, but remembers where the last time landed.
+//! Stepping through times in order (forwards or backwards) only has to look
+//! at the neighboring samples instead of searching all of the acyclic times.
+class ALEMBIC_EXPORT ITimeCursor
+{
+public:
+    ITimeCursor();
+
+    ITimeCursor( AbcA::TimeSamplingPtr iTimeSampling, index_t iNumSamples );
+
+    //! Returns the same index as iSS.getIndex( timeSampling, numSamples )
+    index_t getIndex( const ISampleSelector &iSS );
+
+    AbcA::TimeSamplingPtr getTimeSampling() const { return m_timeSampling; }
+
+    index_t getNumSamples() const { return m_numSamples; }
+
+private:
+    index_t getFloorIndex( chrono_t iTime );
+
+    AbcA::TimeSamplingPtr m_timeSampling;
+    index_t m_numSamples;
+    bool m_acyclic;
+
+    // the floor index of the last time we were asked about
+    index_t m_floorIndex;
+};
+
+//-*****************************************************************************
+//! Reads the samples of a typed array property for a sequence of times, such
+//! as during playback.  When the sample at the new time has the same key as
+//! the one that was last read, the last sample is returned without reading
+//! its data again.
+template <class PROP>
+class IArrayPlaybackCursor
+{
+public:
+    typedef PROP property_type;
+    typedef typename PROP::sample_ptr_type sample_ptr_type;
+
+    IArrayPlaybackCursor() : m_index( -1 ), m_hasKey( false ) {}
+
+    explicit IArrayPlaybackCursor( const PROP &iProperty )
+      : m_property( iProperty )
+      , m_time( iProperty.getTimeSampling(), iProperty.getNumSamples() )
+      , m_index( -1 )
+      , m_hasKey( false ) {}
+
+    //! Returns the sample for iSS, which is the same sample that was
+    //! returned last time if the data hasn't changed.
+    sample_ptr_type getValue( const ISampleSelector &iSS = ISampleSelector() )
+    {
+        index_t index = m_time.getIndex( iSS );
+        if ( m_sample && index == m_index )
+        {
+            return m_sample;
+        }
+
+        ISampleSelector ss( index );
+        AbcA::ArraySampleKey key;
+        bool hasKey = m_property.getKey( key, ss );
+
+        if ( !( m_sample && hasKey && m_hasKey && key == m_key ) )
+        {
+            m_property.get( m_sample, ss );
+            m_key = key;
+            m_hasKey = hasKey;
+        }
+
+        m_index = index;
+        return m_sample;
+    }
+
+    //! The index of the sample that was last returned, -1 if there wasn't one
+    index_t getIndex() const { return m_index; }
+
+    const PROP &getProperty() const { return m_property; }
+
+private:
+    PROP m_property;
+    ITimeCursor m_time;
+
+    index_t m_index;
+    sample_ptr_type m_sample;
+    AbcA::ArraySampleKey m_key;
+    bool m_hasKey;
+};
+
+//-*****************************************************************************
+//! Reads the samples of a typed scalar property for a sequence of times,
+//! a sample is only read again when the time lands on a different index.
+template <class PROP>
+class IScalarPlaybackCursor
+{
+public:
+    typedef PROP property_type;
+    typedef typename PROP::value_type value_type;
+
+    IScalarPlaybackCursor() : m_index( -1 ) {}
+
+    explicit IScalarPlaybackCursor( const PROP &iProperty )
+      : m_property( iProperty )
+      , m_time( iProperty.getTimeSampling(), iProperty.getNumSamples() )
+      , m_index( -1 ) {}
+
+    const value_type &getValue( const ISampleSelector &iSS = ISampleSelector() )
+    {
+        index_t index = m_time.getIndex( iSS );
+        if ( index != m_index )
+        {
+            m_property.get( m_value, ISampleSelector( index ) );
+            m_index = index;
+        }
+        return m_value;
+    }
+
+    //! The index of the sample that was last returned, -1 if there wasn't one
+    index_t getIndex() const { return m_index; }
+
+    const PROP &getProperty() const { return m_property; }
+
+private:
+    PROP m_property;
+    ITimeCursor m_time;
+
+    index_t m_index;
+    value_type m_value;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
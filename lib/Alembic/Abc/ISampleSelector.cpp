@@ -35,11 +35,21 @@
 //-*****************************************************************************
 
 #include <Alembic/Abc/ISampleSelector.h>
+#include <Alembic/Abc/IFrameContext.h>
 
 namespace Alembic {
 namespace Abc {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+ISampleSelector::ISampleSelector( IFrameContext & iContext )
+  : m_requestedIndex( -1 ),
+    m_requestedTime( iContext.getTime() ),
+    m_requestedTimeIndexType( iContext.getTimeIndexType() ),
+    m_frameContext( &iContext )
+{
+}
+
 //-*****************************************************************************
 index_t ISampleSelector::getIndex( const AbcA::TimeSamplingPtr & iTsmp,
     index_t iNumSamples ) const
@@ -50,6 +60,10 @@ index_t ISampleSelector::getIndex( const AbcA::TimeSamplingPtr & iTsmp,
     {
         retIdx = m_requestedIndex;
     }
+    else if ( m_frameContext )
+    {
+        return m_frameContext->getIndex( iTsmp, iNumSamples );
+    }
     else if ( m_requestedTimeIndexType == kNearIndex )
     {
         retIdx = iTsmp->getNearIndex( m_requestedTime, iNumSamples ).first;
@@ -44,6 +44,8 @@ namespace Alembic {
 namespace Abc {
 namespace ALEMBIC_VERSION_NS {
 
+class IFrameContext;
+
 //-*****************************************************************************
 class ALEMBIC_EXPORT ISampleSelector
 {
@@ -58,23 +60,32 @@ public:
     ISampleSelector()
       : m_requestedIndex( 0 ),
         m_requestedTime( 0.0 ),
-        m_requestedTimeIndexType( kNearIndex ) {}
+        m_requestedTimeIndexType( kNearIndex ),
+        m_frameContext( NULL ) {}
 
     ISampleSelector( index_t iReqIdx )
       : m_requestedIndex( iReqIdx ),
         m_requestedTime( 0.0 ),
-        m_requestedTimeIndexType( kNearIndex ) {}
+        m_requestedTimeIndexType( kNearIndex ),
+        m_frameContext( NULL ) {}
 
     explicit ISampleSelector( chrono_t iReqTime,
                               TimeIndexType iReqIdxType = kNearIndex )
       : m_requestedIndex( -1 ),
         m_requestedTime( iReqTime ),
-        m_requestedTimeIndexType( iReqIdxType ) {}
+        m_requestedTimeIndexType( iReqIdxType ),
+        m_frameContext( NULL ) {}
+
+    //! Selects the time and index type of the frame context, the index each
+    //! TimeSampling resolves to is shared by everything read with selectors
+    //! made from the same context.
+    explicit ISampleSelector( IFrameContext & iContext );
 
     index_t getRequestedIndex() const { return m_requestedIndex; }
     chrono_t getRequestedTime() const { return m_requestedTime; }
     TimeIndexType getRequestedTimeIndexType() const
     { return m_requestedTimeIndexType; }
+    IFrameContext * getFrameContext() const { return m_frameContext; }
 
     index_t getIndex( const AbcA::TimeSamplingPtr & iTsmp, index_t
         iNumSamples ) const;
@@ -83,6 +94,7 @@ private:
     index_t m_requestedIndex;
     chrono_t m_requestedTime;
     TimeIndexType m_requestedTimeIndexType;
+    IFrameContext * m_frameContext;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
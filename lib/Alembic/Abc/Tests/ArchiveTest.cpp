@@ -38,6 +38,7 @@
 #include <Alembic/AbcCoreFactory/All.h>
 #include <Alembic/Abc/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+#include <fstream>
 
 #ifdef ALEMBIC_WITH_HDF5
 #include <Alembic/AbcCoreHDF5/All.h>
@@ -170,10 +171,151 @@ void scopingTest(bool useOgawa)
     }
 }
 
+void sharedArchiveTest()
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "sharedArchive.abc" );
+        OObject child( archive.getTop(), "child" );
+    }
+
+    AbcF::IFactory::setSharedArchiveRetainCount( 0 );
+    TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 0 );
+
+    {
+        AbcF::IFactory factory;
+        IArchive a = factory.getArchive( "sharedArchive.abc" );
+        IArchive b = factory.getArchive( "sharedArchive.abc" );
+
+        // not shared unless asked for
+        TESTING_ASSERT( a.getPtr() != b.getPtr() );
+        TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 0 );
+
+        factory.setUseSharedArchives( true );
+        factory.setPolicy( ErrorHandler::kQuietNoopPolicy );
+        AbcF::IFactory::CoreType coreType;
+        IArchive c = factory.getArchive( "sharedArchive.abc", coreType );
+        TESTING_ASSERT( coreType == AbcF::IFactory::kOgawa );
+        TESTING_ASSERT( c.getErrorHandlerPolicy() ==
+                        ErrorHandler::kQuietNoopPolicy );
+
+        AbcF::IFactory other;
+        other.setUseSharedArchives( true );
+        IArchive d = other.getArchive( "./sharedArchive.abc", coreType );
+        TESTING_ASSERT( coreType == AbcF::IFactory::kOgawa );
+        TESTING_ASSERT( c.getPtr() == d.getPtr() );
+        TESTING_ASSERT( d.getErrorHandlerPolicy() ==
+                        ErrorHandler::kThrowPolicy );
+        TESTING_ASSERT( d.getTop().getChildHeader( "child" ) != NULL );
+        TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 1 );
+
+        // opened differently so it isn't the same
+        other.setOgawaNumStreams( 2 );
+        IArchive e = other.getArchive( "sharedArchive.abc" );
+        TESTING_ASSERT( e.getPtr() != c.getPtr() );
+        TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 2 );
+
+        // missing and invalid files aren't shared
+        IArchive f = other.getArchive( "sharedArchiveMissing.abc", coreType );
+        TESTING_ASSERT( !f.valid() && coreType == AbcF::IFactory::kUnknown );
+        TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 2 );
+    }
+
+    // nothing references them, and nothing is retained
+    TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 0 );
+
+    AbcF::IFactory::setSharedArchiveRetainCount( 1 );
+    TESTING_ASSERT( AbcF::IFactory::getSharedArchiveRetainCount() == 1 );
+
+    AbcF::IFactory factory;
+    factory.setUseSharedArchives( true );
+    Alembic::AbcCoreAbstract::ArchiveReader * ptr =
+        factory.getArchive( "sharedArchive.abc" ).getPtr().get();
+    TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 1 );
+    TESTING_ASSERT(
+        factory.getArchive( "sharedArchive.abc" ).getPtr().get() == ptr );
+
+    // only the most recent one is kept open
+    factory.setOgawaNumStreams( 2 );
+    factory.getArchive( "sharedArchive.abc" );
+    TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 1 );
+
+    AbcF::IFactory::releaseSharedArchives();
+    TESTING_ASSERT( AbcF::IFactory::getNumSharedArchives() == 0 );
+
+    AbcF::IFactory::setSharedArchiveRetainCount( 8 );
+}
+
+void sniffTest()
+{
+    AbcF::IFactory factory;
+    AbcF::IFactory::CoreType coreType;
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "sniffOgawa.abc" );
+        OObject child( archive.getTop(), "child" );
+    }
+
+    factory.setOgawaNumStreams( 2 );
+    IArchive archive = factory.getArchive( "sniffOgawa.abc", coreType );
+    TESTING_ASSERT( coreType == AbcF::IFactory::kOgawa );
+    TESTING_ASSERT( archive.getName() == "sniffOgawa.abc" );
+    TESTING_ASSERT( archive.getErrorHandlerPolicy() ==
+                    ErrorHandler::kThrowPolicy );
+    TESTING_ASSERT( archive.getTop().getChildHeader( "child" ) != NULL );
+
+    {
+        std::ofstream strm( "sniffJunk.abc", std::ios::binary );
+        strm << "This is not an archive";
+    }
+    archive = factory.getArchive( "sniffJunk.abc", coreType );
+    TESTING_ASSERT( !archive.valid() && coreType == AbcF::IFactory::kUnknown );
+
+    // too short to hold a header
+    {
+        std::ofstream strm( "sniffShort.abc", std::ios::binary );
+        strm << "Ogawa";
+    }
+    archive = factory.getArchive( "sniffShort.abc", coreType );
+    TESTING_ASSERT( !archive.valid() && coreType == AbcF::IFactory::kUnknown );
+
+    // starts out like Ogawa but isn't
+    {
+        std::ofstream strm( "sniffBadOgawa.abc", std::ios::binary );
+        strm << "Ogawa and then some garbage";
+    }
+    archive = factory.getArchive( "sniffBadOgawa.abc", coreType );
+    TESTING_ASSERT( !archive.valid() && coreType == AbcF::IFactory::kUnknown );
+
+    archive = factory.getArchive( "sniffMissing.abc", coreType );
+    TESTING_ASSERT( !archive.valid() && coreType == AbcF::IFactory::kUnknown );
+
+#ifndef ALEMBIC_WITH_HDF5
+    {
+        std::ofstream strm( "sniffHDF5.abc", std::ios::binary );
+        strm << "\211HDF\r\n\032\n and the rest";
+    }
+    archive = factory.getArchive( "sniffHDF5.abc", coreType );
+    TESTING_ASSERT( !archive.valid() && coreType == AbcF::IFactory::kHDF5 );
+#endif
+
+    // the bad ones are skipped when layering
+    std::vector< std::string > files;
+    files.push_back( "sniffJunk.abc" );
+    files.push_back( "sniffOgawa.abc" );
+    files.push_back( "sniffMissing.abc" );
+    archive = factory.getArchive( files, coreType );
+    TESTING_ASSERT( coreType == AbcF::IFactory::kLayer );
+    TESTING_ASSERT( archive.getTop().getChildHeader( "child" ) != NULL );
+}
+
 int main( int argc, char *argv[] )
 {
     archiveInfoTest(true);
     scopingTest(true);
+    sharedArchiveTest();
+    sniffTest();
 
 #ifdef ALEMBIC_WITH_HDF5
     archiveInfoTest(false);
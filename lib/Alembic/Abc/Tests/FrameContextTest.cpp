@@ -0,0 +1,137 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+//-*****************************************************************************
+void frameContextTest()
+{
+    std::string archiveName = "frameContext.abc";
+    std::vector< chrono_t > times;
+    for ( size_t i = 0; i < 30; ++i )
+    {
+        times.push_back( i * 0.5 + ( i % 4 ) * 0.1 );
+    }
+
+    const size_t numProps = 50;
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        uint32_t acyclicIdx = archive.addTimeSampling( AbcA::TimeSampling(
+            AbcA::TimeSamplingType( AbcA::TimeSamplingType::kAcyclic ),
+            times ) );
+        uint32_t uniformIdx = archive.addTimeSampling(
+            AbcA::TimeSampling( 0.25, 0.0 ) );
+
+        OObject obj( archive.getTop(), "obj" );
+        for ( size_t i = 0; i < numProps; ++i )
+        {
+            std::ostringstream name;
+            name << "prop" << i;
+            OInt32Property prop( obj.getProperties(), name.str(),
+                                 acyclicIdx );
+
+            // every fifth property has fewer samples
+            size_t numSamples = ( i % 5 == 0 ) ? 10 : times.size();
+            for ( size_t j = 0; j < numSamples; ++j )
+            {
+                prop.set( ( int32_t ) ( i * 1000 + j ) );
+            }
+        }
+
+        OInt32ArrayProperty arrayProp( obj.getProperties(), "ints",
+                                       uniformIdx );
+        for ( int32_t j = 0; j < 40; ++j )
+        {
+            std::vector< int32_t > vals( 4, j );
+            arrayProp.set( Int32ArraySample( vals ) );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName );
+    IObject obj( archive.getTop(), "obj" );
+    IInt32ArrayProperty arrayProp( obj.getProperties(), "ints" );
+
+    ISampleSelector::TimeIndexType types[3] = { ISampleSelector::kFloorIndex,
+        ISampleSelector::kCeilIndex, ISampleSelector::kNearIndex };
+
+    for ( chrono_t t = -1.0; t < 17.0; t += 0.15 )
+    {
+        for ( size_t k = 0; k < 3; ++k )
+        {
+            IFrameContext context( t, types[k] );
+            ISampleSelector frameSS( context );
+            ISampleSelector ss( t, types[k] );
+
+            TESTING_ASSERT( frameSS.getFrameContext() == &context );
+            TESTING_ASSERT( frameSS.getRequestedTime() == t );
+            TESTING_ASSERT( frameSS.getRequestedTimeIndexType() == types[k] );
+
+            for ( size_t i = 0; i < numProps; ++i )
+            {
+                std::ostringstream name;
+                name << "prop" << i;
+                IInt32Property prop( obj.getProperties(), name.str() );
+                TESTING_ASSERT( prop.getValue( frameSS ) ==
+                                prop.getValue( ss ) );
+            }
+
+            Int32ArraySamplePtr a = arrayProp.getValue( frameSS );
+            Int32ArraySamplePtr b = arrayProp.getValue( ss );
+            TESTING_ASSERT( ( *a )[0] == ( *b )[0] );
+
+            // one for each number of samples on the acyclic sampling,
+            // uniform sampling is computed directly
+            TESTING_ASSERT( context.getNumCachedIndices() == 2 );
+
+            // explicit indices still win
+            TESTING_ASSERT( ISampleSelector( ( index_t ) 3 ).getIndex(
+                arrayProp.getTimeSampling(), 40 ) == 3 );
+        }
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    frameContextTest();
+    return 0;
+}
@@ -0,0 +1,219 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+//-*****************************************************************************
+// a lopsided hierarchy, object "a" has most of the objects under it
+void writeChildren( OObject & iParent, size_t iDepth, size_t iWidth )
+{
+    if ( iDepth == 0 )
+    {
+        return;
+    }
+
+    for ( size_t i = 0; i < iWidth; ++i )
+    {
+        std::ostringstream name;
+        name << ( i == 0 ? "a" : ( i == 1 ? "skip" : "c" ) ) << i;
+        OObject child( iParent, name.str() );
+        writeChildren( child, iDepth - 1, i == 0 ? iWidth : 2 );
+    }
+}
+
+//-*****************************************************************************
+void collectSerial( const IObject & iObject, bool iPrune,
+                    std::vector< std::string > & oNames )
+{
+    oNames.push_back( iObject.getFullName() );
+    if ( iPrune && iObject.getName().find( "skip" ) == 0 )
+    {
+        return;
+    }
+
+    for ( size_t i = 0; i < iObject.getNumChildren(); ++i )
+    {
+        collectSerial( iObject.getChild( i ), iPrune, oNames );
+    }
+}
+
+//-*****************************************************************************
+class NameCollector : public IHierarchyVisitor
+{
+public:
+    NameCollector( size_t iNumThreads, bool iPrune )
+      : IHierarchyVisitor( iNumThreads )
+      , m_prune( iPrune )
+      , m_names( getNumThreads() )
+    {
+    }
+
+    std::vector< std::string > getNames() const
+    {
+        std::vector< std::string > names;
+        for ( size_t i = 0; i < m_names.size(); ++i )
+        {
+            names.insert( names.end(), m_names[i].begin(),
+                          m_names[i].end() );
+        }
+        return names;
+    }
+
+protected:
+    virtual bool visit( const IObject & iObject, size_t iThreadIndex )
+    {
+        TESTING_ASSERT( iThreadIndex < getNumThreads() );
+
+        // read something so there is some work to do
+        ICompoundProperty props = iObject.getProperties();
+        TESTING_ASSERT( props.valid() );
+
+        m_names[iThreadIndex].push_back( iObject.getFullName() );
+        return !( m_prune && iObject.getName().find( "skip" ) == 0 );
+    }
+
+private:
+    bool m_prune;
+    std::vector< std::vector< std::string > > m_names;
+};
+
+//-*****************************************************************************
+class Thrower : public IHierarchyVisitor
+{
+public:
+    Thrower( size_t iNumThreads ) : IHierarchyVisitor( iNumThreads ) {}
+
+protected:
+    virtual bool visit( const IObject & iObject, size_t iThreadIndex )
+    {
+        if ( iObject.getName() == "c2" )
+        {
+            throw std::runtime_error( "c2" );
+        }
+        return true;
+    }
+};
+
+//-*****************************************************************************
+void visitTest()
+{
+    std::string archiveName = "hierarchyVisitor.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        OObject top = archive.getTop();
+        writeChildren( top, 6, 5 );
+    }
+
+    AbcA::ReadArraySampleCachePtr cachePtr;
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive( 4 ), archiveName,
+                      ErrorHandler::kThrowPolicy, cachePtr );
+
+    for ( size_t prune = 0; prune < 2; ++prune )
+    {
+        std::vector< std::string > expected;
+        collectSerial( archive.getTop(), prune != 0, expected );
+        TESTING_ASSERT( expected.size() > 100 );
+
+        // a single thread goes in the same order as recursing
+        NameCollector serial( 1, prune != 0 );
+        TESTING_ASSERT( serial.getNumThreads() == 1 );
+        serial.traverse( archive.getTop() );
+        TESTING_ASSERT( serial.getNames() == expected );
+
+        std::sort( expected.begin(), expected.end() );
+
+        size_t numThreads[3] = { 0, 4, 16 };
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            NameCollector visitor( numThreads[i], prune != 0 );
+            TESTING_ASSERT( visitor.getNumThreads() > 0 );
+            visitor.traverse( archive.getTop() );
+
+            std::vector< std::string > names = visitor.getNames();
+            std::sort( names.begin(), names.end() );
+            TESTING_ASSERT( names == expected );
+        }
+
+        // part of the hierarchy
+        IObject a0( archive.getTop(), "a0" );
+        std::vector< std::string > subExpected;
+        collectSerial( a0, prune != 0, subExpected );
+        std::sort( subExpected.begin(), subExpected.end() );
+
+        NameCollector sub( 4, prune != 0 );
+        sub.traverse( a0 );
+        std::vector< std::string > names = sub.getNames();
+        std::sort( names.begin(), names.end() );
+        TESTING_ASSERT( names == subExpected );
+    }
+
+    // an invalid root visits nothing
+    NameCollector empty( 4, false );
+    empty.traverse( IObject() );
+    TESTING_ASSERT( empty.getNames().empty() );
+
+    // exceptions make it out of the worker threads
+    for ( size_t i = 1; i < 8; i += 6 )
+    {
+        Thrower thrower( i );
+        bool caught = false;
+        try
+        {
+            thrower.traverse( archive.getTop() );
+        }
+        catch ( std::runtime_error & e )
+        {
+            caught = std::string( e.what() ) == "c2";
+        }
+        TESTING_ASSERT( caught );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    visitTest();
+    return 0;
+}
@@ -272,6 +272,115 @@ void readHierarchyMulti(const std::string &archiveName)
 #endif
 }
 
+void pathLookupTest(bool useOgawa)
+{
+    std::string archiveName("pathLookup.abc");
+    {
+        OArchive archive;
+        if (useOgawa)
+        {
+            archive = OArchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                archiveName, ErrorHandler::kThrowPolicy );
+        }
+#ifdef ALEMBIC_WITH_HDF5
+        else
+        {
+            archive = OArchive( Alembic::AbcCoreHDF5::WriteArchive(),
+                archiveName, ErrorHandler::kThrowPolicy );
+        }
+#endif
+
+        OObject archiveTop = archive.getTop();
+        for (unsigned int ii=0; ii<3; ii++)
+        {
+            unsigned int d = 0;
+            std::ostringstream strm;
+            strm << "child_0_" << ii;
+            OObject child( archiveTop, strm.str() );
+            recursivelyAddChildren( child, 4, d, 3 );
+        }
+
+        OObject src( archiveTop, "src" );
+        OObject srcChild( src, "a" );
+        OObject srcGrandChild( srcChild, "b" );
+
+        OObject other( archiveTop, "other" );
+        other.addChildInstance( src, "inst" );
+    }
+
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( archiveName );
+
+    // everything is found the same way as walking there
+    IObject a = archive.getTop().getChild( "child_0_2" );
+    IObject b = a.getChild( "child_1_0" ).getChild( "child_2_1" );
+    IObject c = b.getChild( "child_3_2" ).getChild( "child_4_0" );
+
+    for (int ii=0; ii<2; ii++)
+    {
+        IObject found = archive.getObject( "/child_0_2" );
+        ABCA_ASSERT( found.valid() &&
+                     found.getFullName() == a.getFullName(),
+                     "Didn't find /child_0_2" );
+
+        found = archive.getObject( b.getFullName() );
+        ABCA_ASSERT( found.getFullName() == b.getFullName(),
+                     "Didn't find " << b.getFullName() );
+
+        found = archive.getObject( c.getFullName() );
+        ABCA_ASSERT( found.getFullName() == c.getFullName(),
+                     "Didn't find " << c.getFullName() );
+        ABCA_ASSERT( found.getPtr() == c.getPtr(),
+                     "Looking up an open object gave a new reader" );
+
+        // extra slashes are ignored
+        found = archive.getObject( "child_0_2//child_1_0/child_2_1/" );
+        ABCA_ASSERT( found.getFullName() == b.getFullName(),
+                     "Didn't find " << b.getFullName() << " with slashes" );
+
+        found = archive.getObject( "/" );
+        ABCA_ASSERT( found.getFullName() == "/", "Didn't find the top" );
+
+        // with nothing else open
+        a.reset();
+        b.reset();
+        c.reset();
+        found = archive.getObject( "/child_0_0/child_1_1/child_2_2" );
+        ABCA_ASSERT( found.getFullName() == "/child_0_0/child_1_1/child_2_2",
+                     "Didn't find /child_0_0/child_1_1/child_2_2" );
+        found.reset();
+
+        a = archive.getTop().getChild( "child_0_2" );
+        b = a.getChild( "child_1_0" ).getChild( "child_2_1" );
+        c = b.getChild( "child_3_2" ).getChild( "child_4_0" );
+    }
+
+    // and things that aren't there
+    ABCA_ASSERT( !archive.getObject( "/child_0_3" ).valid(),
+                 "Found /child_0_3" );
+    ABCA_ASSERT( !archive.getObject( "/child_0_2/child_1_0/nope" ).valid(),
+                 "Found /child_0_2/child_1_0/nope" );
+    ABCA_ASSERT( !archive.getObject(
+        "/child_0_2/child_1_0/child_2_1/child_3_2/child_4_0/x" ).valid(),
+        "Found a child of a leaf" );
+
+    // through an instance
+    IObject inst = archive.getObject( "/other/inst" );
+    ABCA_ASSERT( inst.valid() && inst.isInstanceRoot(),
+                 "Didn't find /other/inst" );
+    ABCA_ASSERT( inst.getNumChildren() == 1, "Wrong instance children" );
+    ABCA_ASSERT( inst.instanceSourcePath() == "/src",
+                 "Wrong instance source" );
+
+    IObject instChild = archive.getObject( "/other/inst/a/b" );
+    ABCA_ASSERT( instChild.valid() && instChild.isInstanceDescendant(),
+                 "Didn't find a child of an instance" );
+    ABCA_ASSERT( instChild.getFullName() == "/other/inst/a/b",
+                 "Wrong instance child: " << instChild.getFullName() );
+    ABCA_ASSERT( !archive.getObject( "/other/inst/nope" ).valid(),
+                 "Found /other/inst/nope" );
+}
+
 void errorHandlerTest(bool useOgawa)
 {
 
@@ -406,5 +515,11 @@ int main( int argc, char *argv[] )
 
     errorHandlerTest(true);
 
+#ifdef ALEMBIC_WITH_HDF5
+    pathLookupTest(false);
+#endif
+
+    pathLookupTest(true);
+
     return 0;
 }
@@ -0,0 +1,236 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+//-*****************************************************************************
+// check that the cursor agrees with ISampleSelector::getIndex
+void checkIndex( ITimeCursor & ioCursor, AbcA::TimeSamplingPtr iTs,
+                 index_t iNumSamples, chrono_t iTime )
+{
+    ISampleSelector::TimeIndexType types[3] = { ISampleSelector::kFloorIndex,
+        ISampleSelector::kCeilIndex, ISampleSelector::kNearIndex };
+
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        ISampleSelector ss( iTime, types[i] );
+        TESTING_ASSERT( ioCursor.getIndex( ss ) ==
+                        ss.getIndex( iTs, iNumSamples ) );
+    }
+}
+
+//-*****************************************************************************
+void checkTimes( AbcA::TimeSamplingPtr iTs, index_t iNumSamples )
+{
+    ITimeCursor cursor( iTs, iNumSamples );
+    chrono_t start = iTs->getSampleTime( 0 );
+    chrono_t end = iTs->getSampleTime( iNumSamples - 1 );
+    chrono_t step = ( end - start ) / ( iNumSamples * 3.0 );
+
+    // forwards, backwards, on and right next to the samples
+    for ( chrono_t t = start - 1.0; t < end + 1.0; t += step )
+    {
+        checkIndex( cursor, iTs, iNumSamples, t );
+    }
+
+    for ( chrono_t t = end + 1.0; t > start - 1.0; t -= step )
+    {
+        checkIndex( cursor, iTs, iNumSamples, t );
+    }
+
+    for ( index_t i = 0; i < iNumSamples; ++i )
+    {
+        chrono_t t = iTs->getSampleTime( i );
+        checkIndex( cursor, iTs, iNumSamples, t );
+        checkIndex( cursor, iTs, iNumSamples, t - 1e-6 );
+        checkIndex( cursor, iTs, iNumSamples, t + 1e-6 );
+        checkIndex( cursor, iTs, iNumSamples, t - 1e-3 );
+    }
+
+    // jumping around
+    uint32_t seed = 3;
+    for ( size_t i = 0; i < 500; ++i )
+    {
+        seed = seed * 1103515245 + 12345;
+        chrono_t t = start - 1.0 + ( end - start + 2.0 ) *
+            ( ( seed >> 8 ) & 0xffff ) / 65535.0;
+        checkIndex( cursor, iTs, iNumSamples, t );
+    }
+
+    // indices are passed through
+    TESTING_ASSERT( cursor.getIndex( ISampleSelector( ( index_t ) 3 ) ) ==
+        ISampleSelector( ( index_t ) 3 ).getIndex( iTs, iNumSamples ) );
+    TESTING_ASSERT( cursor.getIndex( ISampleSelector( iNumSamples + 5 ) ) ==
+                    iNumSamples - 1 );
+}
+
+//-*****************************************************************************
+void timeCursorTest()
+{
+    std::vector< chrono_t > times;
+    chrono_t t = 2.0;
+    uint32_t seed = 7;
+    for ( size_t i = 0; i < 200; ++i )
+    {
+        times.push_back( t );
+        seed = seed * 1103515245 + 12345;
+        t += 0.01 + ( ( seed >> 8 ) & 0xff ) / 64.0;
+    }
+
+    AbcA::TimeSamplingPtr acyclic( new AbcA::TimeSampling(
+        AbcA::TimeSamplingType( AbcA::TimeSamplingType::kAcyclic ), times ) );
+    checkTimes( acyclic, 200 );
+
+    // fewer samples than times
+    checkTimes( acyclic, 50 );
+
+    AbcA::TimeSamplingPtr uniform( new AbcA::TimeSampling( 1.0 / 24.0,
+                                                           1.0 ) );
+    checkTimes( uniform, 100 );
+
+    std::vector< chrono_t > cycleTimes;
+    cycleTimes.push_back( 0.0 );
+    cycleTimes.push_back( 0.1 );
+    cycleTimes.push_back( 0.7 );
+    AbcA::TimeSamplingPtr cyclic( new AbcA::TimeSampling(
+        AbcA::TimeSamplingType( 3, 1.0 ), cycleTimes ) );
+    checkTimes( cyclic, 30 );
+
+    ITimeCursor empty( acyclic, 0 );
+    TESTING_ASSERT( empty.getIndex( ISampleSelector( 4.0 ) ) ==
+                    ISampleSelector( 4.0 ).getIndex( acyclic, 0 ) );
+}
+
+//-*****************************************************************************
+void playbackCursorTest()
+{
+    std::string archiveName = "playbackCursor.abc";
+    std::vector< chrono_t > times;
+    for ( size_t i = 0; i < 20; ++i )
+    {
+        times.push_back( i * 0.5 + ( i % 3 ) * 0.1 );
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          archiveName );
+        uint32_t tsIdx = archive.addTimeSampling( AbcA::TimeSampling(
+            AbcA::TimeSamplingType( AbcA::TimeSamplingType::kAcyclic ),
+            times ) );
+
+        OObject obj( archive.getTop(), "obj" );
+        OInt32ArrayProperty arrayProp( obj.getProperties(), "ints", tsIdx );
+        OInt32Property scalarProp( obj.getProperties(), "int", tsIdx );
+
+        // the data changes every 4 samples, sometimes written again and
+        // sometimes repeated
+        std::vector< int32_t > vals( 100 );
+        for ( size_t i = 0; i < times.size(); ++i )
+        {
+            for ( size_t j = 0; j < vals.size(); ++j )
+            {
+                vals[j] = ( int32_t ) ( j + i / 4 );
+            }
+
+            if ( i % 4 == 1 )
+            {
+                arrayProp.setFromPrevious();
+            }
+            else
+            {
+                arrayProp.set( Int32ArraySample( vals ) );
+            }
+
+            scalarProp.set( ( int32_t ) i );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName );
+    IObject obj( archive.getTop(), "obj" );
+    IInt32ArrayProperty arrayProp( obj.getProperties(), "ints" );
+    IInt32Property scalarProp( obj.getProperties(), "int" );
+
+    IArrayPlaybackCursor< IInt32ArrayProperty > arrayCursor( arrayProp );
+    IScalarPlaybackCursor< IInt32Property > scalarCursor( scalarProp );
+    TESTING_ASSERT( arrayCursor.getIndex() == -1 );
+
+    Int32ArraySamplePtr last;
+    for ( chrono_t t = -1.0; t < 12.0; t += 0.05 )
+    {
+        ISampleSelector ss( t, ISampleSelector::kFloorIndex );
+        index_t idx = ss.getIndex( arrayProp.getTimeSampling(),
+                                   arrayProp.getNumSamples() );
+
+        Int32ArraySamplePtr samp = arrayCursor.getValue( ss );
+        TESTING_ASSERT( arrayCursor.getIndex() == idx );
+        TESTING_ASSERT( samp->size() == 100 );
+        TESTING_ASSERT( ( *samp )[7] == ( int32_t ) ( 7 + idx / 4 ) );
+
+        // the same data doesn't get read again
+        if ( last && ( *last )[7] == ( *samp )[7] )
+        {
+            TESTING_ASSERT( last == samp );
+        }
+        last = samp;
+
+        TESTING_ASSERT( scalarCursor.getValue( ss ) == ( int32_t ) idx );
+        TESTING_ASSERT( scalarCursor.getIndex() == idx );
+    }
+
+    // and backwards
+    for ( chrono_t t = 12.0; t > -1.0; t -= 0.3 )
+    {
+        ISampleSelector ss( t );
+        index_t idx = ss.getIndex( arrayProp.getTimeSampling(),
+                                   arrayProp.getNumSamples() );
+        TESTING_ASSERT( ( *arrayCursor.getValue( ss ) )[0] ==
+                        ( int32_t ) ( idx / 4 ) );
+        TESTING_ASSERT( scalarCursor.getValue( ss ) == ( int32_t ) idx );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    timeCursorTest();
+    playbackCursorTest();
+    return 0;
+}
@@ -96,6 +96,12 @@ public:
     //! corresponding to this archive.
     virtual ObjectReaderPtr getTop() = 0;
 
+    //! Get (or open) the object reader at the given full path, such as
+    //! "/a/b/c", or an empty pointer if there is no object there.  The
+    //! default walks down from the top object one level at a time,
+    //! implementations may override it with something faster.
+    virtual ObjectReaderPtr getObject( const std::string &iFullName );
+
     //! Get the read array sample cache. It may be a NULL pointer.
     //! Caches can be shared amongst separate archives, and caching
     //! will is disabled if a NULL cache is returned here.
@@ -37,6 +37,7 @@
 #ifndef _Alembic_AbcCoreAbstract_MetaData_h_
 #define _Alembic_AbcCoreAbstract_MetaData_h_
 
+#include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 
 namespace Alembic {
@@ -56,7 +57,10 @@ namespace ALEMBIC_VERSION_NS {
 //! In order to not have duplicated (and possibly conflicting) policy
 //! implementation, we present this class here as a MOSTLY-WRITE-ONCE interface,
 //! with selective exception throwing behavior for failed writes.
-class MetaData
+//! Copies share the same underlying TokenMap until one of them is changed,
+//! so the many headers read from a file which have the same MetaData only
+//! hold one dictionary between them.
+class ALEMBIC_EXPORT MetaData
 {
 public:
     //-*************************************************************************
@@ -122,8 +126,10 @@ public:
     //! \internal For library implementation internal use.
     void deserialize( const std::string &iFrom )
     {
-        m_tokenMap.clear();
-        m_tokenMap.setUnique( iFrom, ';', '=', true );
+        Alembic::Util::shared_ptr< token_map_type > tokenMap(
+            new token_map_type() );
+        tokenMap->setUnique( iFrom, ';', '=', true );
+        m_tokenMap = tokenMap;
     }
 
     //! Serialization will convert the contents of this MetaData into a
@@ -131,13 +137,13 @@ public:
     //! \internal For library implementation internal use.
     std::string serialize() const
     {
-        return m_tokenMap.get( ';', '=', true );
+        return tokenMap().get( ';', '=', true );
     }
 
     //-*************************************************************************
     // SIZE
     //-*************************************************************************
-    size_t size() const { return m_tokenMap.size(); }
+    size_t size() const { return tokenMap().size(); }
 
     //-*************************************************************************
     // ITERATION
@@ -145,19 +151,19 @@ public:
 
     //! Returns a \ref const_iterator corresponding to the beginning of the
     //! MetaData or the end of the MetaData if empty.
-    const_iterator begin() const { return m_tokenMap.begin(); }
+    const_iterator begin() const { return tokenMap().begin(); }
 
     //! Returns a \ref const_iterator corresponding to the end of the
     //! MetaData.
-    const_iterator end() const { return m_tokenMap.end(); }
+    const_iterator end() const { return tokenMap().end(); }
 
     //! Returns a \ref const_reverse_iterator corresponding to the beginning
     //! of the MetaData or the end of the MetaData if empty.
-    const_reverse_iterator rbegin() const { return m_tokenMap.rbegin(); }
+    const_reverse_iterator rbegin() const { return tokenMap().rbegin(); }
 
     //! Returns an \ref const_reverse_iterator corresponding to the end
     //! of the MetaData.
-    const_reverse_iterator rend() const { return m_tokenMap.rend(); }
+    const_reverse_iterator rend() const { return tokenMap().rend(); }
 
     //-*************************************************************************
     // ACCESS/ASSIGNMENT
@@ -167,7 +173,7 @@ public:
     //! This will silently overwrite an existing value.
     void set( const std::string &iKey, const std::string &iData )
     {
-        m_tokenMap.setValue( iKey, iData );
+        mutableTokenMap().setValue( iKey, iData );
     }
 
     //! setUnique lets you set a key/data pair,
@@ -176,10 +182,10 @@ public:
     //! \remarks Not the most efficient implementation at the moment.
     void setUnique( const std::string &iKey, const std::string &iData )
     {
-        std::string found = m_tokenMap.value( iKey );
+        std::string found = tokenMap().value( iKey );
         if ( found == "" )
         {
-            m_tokenMap.setValue( iKey, iData );
+            mutableTokenMap().setValue( iKey, iData );
         }
         else if ( found != iData )
         {
@@ -191,14 +197,14 @@ public:
     //! ...
     std::string get( const std::string &iKey ) const
     {
-        return m_tokenMap.value( iKey );
+        return tokenMap().value( iKey );
     }
 
     //! getRequired returns the value, and throws an exception if it is
     //! not found.
     std::string getRequired( const std::string &iKey ) const
     {
-        std::string ret = m_tokenMap.value( iKey );
+        std::string ret = tokenMap().value( iKey );
         if ( ret == "" )
         {
             ABCA_THROW( "Key: " << iKey << " did not exist in MetaData" );
@@ -224,7 +230,7 @@ public:
         for ( const_iterator iter = iMetaData.begin();
               iter != iMetaData.end(); ++iter )
         {
-            if ( !m_tokenMap.tokenExists( (*iter).first ) )
+            if ( !tokenMap().tokenExists( (*iter).first ) )
             {
                 set( (*iter).first, (*iter).second );
             }
@@ -287,11 +293,35 @@ public:
     //! It is for this reason that we explicitly do not overload the == operator.
     bool matchesExactly( const MetaData &iMetaData ) const
     {
-        return m_tokenMap.exactMatch( iMetaData.m_tokenMap );
+        return m_tokenMap == iMetaData.m_tokenMap ||
+            tokenMap().exactMatch( iMetaData.tokenMap() );
     }
 
 private:
-    Alembic::Util::TokenMap m_tokenMap;
+    const token_map_type & tokenMap() const
+    {
+        return m_tokenMap ? *m_tokenMap : emptyTokenMap();
+    }
+
+    // makes a copy of the TokenMap first if it is shared
+    token_map_type & mutableTokenMap()
+    {
+        if ( !m_tokenMap )
+        {
+            m_tokenMap.reset( new token_map_type() );
+        }
+        else if ( m_tokenMap.use_count() > 1 )
+        {
+            m_tokenMap.reset( new token_map_type( *m_tokenMap ) );
+        }
+        return *m_tokenMap;
+    }
+
+    // what empty MetaData without a TokenMap of its own uses
+    static const token_map_type & emptyTokenMap();
+
+    // Never changed once it is shared with another MetaData
+    Alembic::Util::shared_ptr< token_map_type > m_tokenMap;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -0,0 +1,145 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+
+#include "Assert.h"
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+void testEmpty()
+{
+    AbcA::MetaData md;
+    TESTING_ASSERT( md.size() == 0 );
+    TESTING_ASSERT( md.begin() == md.end() );
+    TESTING_ASSERT( md.rbegin() == md.rend() );
+    TESTING_ASSERT( md.get( "a" ) == "" );
+    TESTING_ASSERT( md.serialize() == "" );
+
+    AbcA::MetaData other;
+    TESTING_ASSERT( md.matchesExactly( other ) );
+    TESTING_ASSERT( md.matches( other ) );
+
+    other.set( "a", "1" );
+    TESTING_ASSERT( !md.matchesExactly( other ) );
+    TESTING_ASSERT( other.matches( md ) );
+    TESTING_ASSERT( md.size() == 0 );
+}
+
+//-*****************************************************************************
+void testCopyOnWrite()
+{
+    AbcA::MetaData md;
+    md.set( "schema", "AbcGeom_PolyMesh_v1" );
+    md.set( "interpretation", "point" );
+
+    // copies share until written to
+    AbcA::MetaData copy( md );
+    AbcA::MetaData assigned;
+    assigned = md;
+    TESTING_ASSERT( &*copy.begin() == &*md.begin() );
+    TESTING_ASSERT( &*assigned.begin() == &*md.begin() );
+    TESTING_ASSERT( copy.matchesExactly( md ) );
+
+    copy.set( "interpretation", "vector" );
+    TESTING_ASSERT( &*copy.begin() != &*md.begin() );
+    TESTING_ASSERT( copy.get( "interpretation" ) == "vector" );
+    TESTING_ASSERT( md.get( "interpretation" ) == "point" );
+    TESTING_ASSERT( assigned.get( "interpretation" ) == "point" );
+    TESTING_ASSERT( !copy.matchesExactly( md ) );
+
+    assigned.setUnique( "extra", "1" );
+    TESTING_ASSERT( assigned.get( "extra" ) == "1" );
+    TESTING_ASSERT( md.get( "extra" ) == "" );
+    TESTING_ASSERT( md.size() == 2 );
+
+    // failing to set doesn't change anything
+    AbcA::MetaData shared( md );
+    bool threw = false;
+    try
+    {
+        shared.setUnique( "schema", "AbcGeom_SubD_v1" );
+    }
+    catch ( std::exception & )
+    {
+        threw = true;
+    }
+    TESTING_ASSERT( threw );
+    TESTING_ASSERT( shared.get( "schema" ) == "AbcGeom_PolyMesh_v1" );
+    TESTING_ASSERT( md.get( "schema" ) == "AbcGeom_PolyMesh_v1" );
+
+    // append into a copy
+    AbcA::MetaData appended( md );
+    AbcA::MetaData more;
+    more.set( "a", "1" );
+    more.set( "schema", "other" );
+    appended.appendOnlyUnique( more );
+    TESTING_ASSERT( appended.get( "a" ) == "1" );
+    TESTING_ASSERT( appended.get( "schema" ) == "AbcGeom_PolyMesh_v1" );
+    TESTING_ASSERT( md.get( "a" ) == "" );
+
+    appended.append( more );
+    TESTING_ASSERT( appended.get( "schema" ) == "other" );
+    TESTING_ASSERT( md.get( "schema" ) == "AbcGeom_PolyMesh_v1" );
+
+    // deserializing replaces the contents without touching the copies
+    AbcA::MetaData deserialized( md );
+    deserialized.deserialize( "x=1;y=2" );
+    TESTING_ASSERT( deserialized.size() == 2 );
+    TESTING_ASSERT( deserialized.get( "x" ) == "1" );
+    TESTING_ASSERT( md.size() == 2 );
+    TESTING_ASSERT( md.get( "x" ) == "" );
+
+    AbcA::MetaData roundTrip;
+    roundTrip.deserialize( md.serialize() );
+    TESTING_ASSERT( roundTrip.matchesExactly( md ) );
+
+    // the last copy is written to in place
+    AbcA::MetaData single;
+    single.set( "a", "1" );
+    const AbcA::MetaData::value_type * first = &*single.begin();
+    single.set( "a", "2" );
+    TESTING_ASSERT( &*single.begin() == first );
+}
+
+//-*****************************************************************************
+int main( int, char** )
+{
+    testEmpty();
+    testCopyOnWrite();
+    return 0;
+}
@@ -34,7 +34,12 @@
 //
 //-*****************************************************************************
 
-#include <fstream>
+#include <sstream>
+#include <functional>
+#include <map>
+#include <deque>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/AbcCoreLayer/Read.h>
 #include <Alembic/AbcCoreFactory/IFactory.h>
@@ -43,15 +48,347 @@
 #include <Alembic/AbcCoreHDF5/All.h>
 #endif
 
+#include <fcntl.h>
+
+#ifdef _MSC_VER
+#include <io.h>
+#include <share.h>
+#else
+#include <unistd.h>
+#endif
+
+#if !defined( _WIN32 ) && !defined( _WIN64 )
+#include <limits.h>
+#include <stdlib.h>
+#endif
+
+// Layered files are opened in parallel with C++11 threads, HDF5 isn't
+// necessarily built thread safe so those are still opened one at a time
+#if !defined( ALEMBIC_WITH_HDF5 ) && !defined( ALEMBIC_LIB_USES_TR1 ) && \
+    __cplusplus >= 201103L
+#define ALEMBIC_FACTORY_PARALLEL_LAYERS
+#include <atomic>
+#include <thread>
+#endif
+
 namespace Alembic {
 namespace AbcCoreFactory {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+struct SharedArchive
+{
+    SharedArchive() : coreType( IFactory::kUnknown ),
+        openLock( new Alembic::Util::mutex() ) {}
+
+    Alembic::Util::weak_ptr< Alembic::AbcCoreAbstract::ArchiveReader >
+        archive;
+    IFactory::CoreType coreType;
+
+    // held while the archive is being opened so that others asking for the
+    // same archive wait for it instead of opening it again
+    Alembic::Util::shared_ptr< Alembic::Util::mutex > openLock;
+};
+
+typedef std::map< std::string, SharedArchive > SharedArchiveMap;
+
+// the process wide registry used when setUseSharedArchives is on
+struct SharedArchiveRegistry
+{
+    SharedArchiveRegistry() : retainCount( 8 ) {}
+
+    Alembic::Util::mutex lock;
+    SharedArchiveMap archives;
+
+    // the most recently requested archives, newest first, which keep
+    // them open for a while after they are otherwise unused
+    std::deque< Alembic::AbcCoreAbstract::ArchiveReaderPtr > retained;
+    size_t retainCount;
+
+    void retain( Alembic::AbcCoreAbstract::ArchiveReaderPtr iArchive )
+    {
+        std::deque< Alembic::AbcCoreAbstract::ArchiveReaderPtr >::iterator
+            it = retained.begin();
+        for ( ; it != retained.end(); ++it )
+        {
+            if ( *it == iArchive )
+            {
+                retained.erase( it );
+                break;
+            }
+        }
+
+        if ( retainCount > 0 )
+        {
+            retained.push_front( iArchive );
+        }
+
+        trim();
+    }
+
+    void trim()
+    {
+        while ( retained.size() > retainCount )
+        {
+            retained.pop_back();
+        }
+    }
+
+    // forget about the archives that have been closed, unless somebody is
+    // in the middle of opening them
+    void prune()
+    {
+        SharedArchiveMap::iterator it = archives.begin();
+        while ( it != archives.end() )
+        {
+            if ( it->second.archive.expired() &&
+                 it->second.openLock.use_count() == 1 )
+            {
+                archives.erase( it++ );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+};
+
+#ifdef ALEMBIC_FACTORY_PARALLEL_LAYERS
+// opens whichever of the files nobody else has started on yet
+struct LayerOpener
+{
+    LayerOpener( IFactory & iFactory,
+                 const std::vector< std::string > & iFileNames,
+                 std::vector< Alembic::AbcCoreAbstract::ArchiveReaderPtr > &
+                     oArchives,
+                 std::atomic< size_t > & ioNext )
+      : factory( iFactory ), fileNames( iFileNames ), archives( oArchives )
+      , next( ioNext ) {}
+
+    void operator()()
+    {
+        for ( size_t i = next++; i < fileNames.size(); i = next++ )
+        {
+            try
+            {
+                archives[i] = factory.getArchive( fileNames[i] ).getPtr();
+            }
+            catch ( std::exception & )
+            {
+                // bad files are skipped
+            }
+        }
+    }
+
+    IFactory & factory;
+    const std::vector< std::string > & fileNames;
+    std::vector< Alembic::AbcCoreAbstract::ArchiveReaderPtr > & archives;
+    std::atomic< size_t > & next;
+};
+#endif
+
+// opens the file the same way Ogawa does so it can be handed over to it
+Alembic::Util::int32_t OpenFile( const std::string & iFileName )
+{
+#ifdef _MSC_VER
+    Alembic::Util::int32_t fid = -1;
+    _sopen_s( &fid, iFileName.c_str(), _O_RDONLY | _O_BINARY | _O_RANDOM,
+              _SH_DENYNO, _S_IREAD );
+    return fid;
+#else
+    return open( iFileName.c_str(), O_RDONLY );
+#endif
+}
+
+void CloseFile( Alembic::Util::int32_t iFid )
+{
+    if ( iFid > -1 )
+    {
+#ifdef _MSC_VER
+        _close( iFid );
+#else
+        close( iFid );
+#endif
+    }
+}
+
+// reads the first 8 bytes of the file, returns false if there aren't 8
+bool ReadHeader( Alembic::Util::int32_t iFid, char * oHeader )
+{
+#ifdef _MSC_VER
+    return _lseek( iFid, 0, SEEK_SET ) == 0 &&
+        _read( iFid, oHeader, 8 ) == 8;
+#else
+    return pread( iFid, oHeader, 8, 0 ) == 8;
+#endif
+}
+
+SharedArchiveRegistry & GetSharedArchiveRegistry()
+{
+    static SharedArchiveRegistry registry;
+    return registry;
+}
+
+// Identifies the file by its canonical path, size and modification time so
+// that a file which is replaced on disk isn't served from a stale archive.
+// Returns false if the file can't be found.
+bool GetFileIdentity( const std::string & iFileName, std::string & oId )
+{
+    std::ostringstream strm;
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+    struct _stat64 st;
+    if ( _stat64( iFileName.c_str(), &st ) != 0 )
+    {
+        return false;
+    }
+
+    char fullPath[_MAX_PATH];
+    if ( _fullpath( fullPath, iFileName.c_str(), _MAX_PATH ) != NULL )
+    {
+        strm << fullPath;
+    }
+    else
+    {
+        strm << iFileName;
+    }
+#else
+    struct stat st;
+    if ( stat( iFileName.c_str(), &st ) != 0 )
+    {
+        return false;
+    }
+
+    char fullPath[PATH_MAX];
+    if ( realpath( iFileName.c_str(), fullPath ) != NULL )
+    {
+        strm << fullPath;
+    }
+    else
+    {
+        strm << iFileName;
+    }
+#endif
+
+    strm << '\0' << st.st_size << '\0' << st.st_mtime;
+    oId = strm.str();
+    return true;
+}
+
+}
+
 IFactory::IFactory()
 {
     m_cacheHierarchy = true;
     m_numStreams = 1;
+    m_retainedReaderCount = 0;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
+    m_useSharedArchives = false;
+}
+
+void IFactory::setSharedArchiveRetainCount( size_t iCount )
+{
+    SharedArchiveRegistry & registry = GetSharedArchiveRegistry();
+    Alembic::Util::scoped_lock l( registry.lock );
+    registry.retainCount = iCount;
+    registry.trim();
+}
+
+size_t IFactory::getSharedArchiveRetainCount()
+{
+    SharedArchiveRegistry & registry = GetSharedArchiveRegistry();
+    Alembic::Util::scoped_lock l( registry.lock );
+    return registry.retainCount;
+}
+
+size_t IFactory::getNumSharedArchives()
+{
+    SharedArchiveRegistry & registry = GetSharedArchiveRegistry();
+    Alembic::Util::scoped_lock l( registry.lock );
+    registry.prune();
+    return registry.archives.size();
+}
+
+void IFactory::releaseSharedArchives()
+{
+    // let the archives go outside of the lock
+    std::deque< Alembic::AbcCoreAbstract::ArchiveReaderPtr > retained;
+    {
+        SharedArchiveRegistry & registry = GetSharedArchiveRegistry();
+        Alembic::Util::scoped_lock l( registry.lock );
+        retained.swap( registry.retained );
+    }
+}
+
+Alembic::Abc::IArchive IFactory::getSharedArchive(
+    const std::string & iFileName, CoreType & oType )
+{
+    std::string fileId;
+    if ( !GetFileIdentity( iFileName, fileId ) )
+    {
+        oType = kUnknown;
+        return Alembic::Abc::IArchive();
+    }
+
+    // how the archive is opened is part of what is shared
+    std::ostringstream strm;
+    strm << fileId << '\0' << m_numStreams << '\0' << m_retainedReaderCount <<
+        '\0' << m_cacheHierarchy << '\0' << m_cachePtr.get();
+    std::string key = strm.str();
+
+    SharedArchiveRegistry & registry = GetSharedArchiveRegistry();
+
+    Alembic::Util::shared_ptr< Alembic::Util::mutex > openLock;
+    {
+        Alembic::Util::scoped_lock l( registry.lock );
+
+        SharedArchive & shared = registry.archives[key];
+        Alembic::AbcCoreAbstract::ArchiveReaderPtr arPtr =
+            shared.archive.lock();
+        if ( arPtr )
+        {
+            registry.retain( arPtr );
+            oType = shared.coreType;
+            return Alembic::Abc::IArchive( arPtr, m_policy );
+        }
+
+        openLock = shared.openLock;
+    }
+
+    // Only those asking for this same archive wait while it is opened, so
+    // that many threads asking for it at once only read it once.
+    Alembic::Util::scoped_lock ol( *openLock );
+
+    {
+        Alembic::Util::scoped_lock l( registry.lock );
+
+        SharedArchive & shared = registry.archives[key];
+        Alembic::AbcCoreAbstract::ArchiveReaderPtr arPtr =
+            shared.archive.lock();
+        if ( arPtr )
+        {
+            registry.retain( arPtr );
+            oType = shared.coreType;
+            return Alembic::Abc::IArchive( arPtr, m_policy );
+        }
+    }
+
+    Alembic::Abc::IArchive archive = getUnsharedArchive( iFileName, oType );
+
+    Alembic::Util::scoped_lock l( registry.lock );
+    registry.prune();
+
+    if ( archive.valid() )
+    {
+        SharedArchive & shared = registry.archives[key];
+        shared.archive = archive.getPtr();
+        shared.coreType = oType;
+        registry.retain( archive.getPtr() );
+    }
+
+    return archive;
 }
 
 IFactory::~IFactory()
@@ -61,47 +398,75 @@ IFactory::~IFactory()
 Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
                                             CoreType & oType )
 {
+    if ( m_useSharedArchives )
+    {
+        return getSharedArchive( iFileName, oType );
+    }
 
-    // try Ogawa first, use kQuietNoop at first in case we fail
-    Alembic::AbcCoreOgawa::ReadArchive ogawa( m_numStreams );
-    Alembic::Abc::IArchive archive( ogawa, iFileName,
-        Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
+    return getUnsharedArchive( iFileName, oType );
+}
 
-    if ( archive.valid() )
+Alembic::Abc::IArchive IFactory::getUnsharedArchive(
+    const std::string & iFileName, CoreType & oType )
+{
+    // look at the start of the file to see which core it belongs to instead
+    // of trying to open it with each of them
+    char header[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    Alembic::Util::int32_t fid = OpenFile( iFileName );
+    bool hasHeader = ( fid > -1 && ReadHeader( fid, header ) );
+
+    if ( hasHeader && header[0] == 'O' && header[1] == 'g' &&
+         header[2] == 'a' && header[3] == 'w' && header[4] == 'a' )
     {
-        oType = kOgawa;
-        archive.getErrorHandler().setPolicy( m_policy );
-        return archive;
+        // the Ogawa archive takes over the file we already opened, failing
+        // to open it is quiet like the other cores
+        Alembic::AbcCoreOgawa::ReadArchive ogawa( m_numStreams );
+        ogawa.setRetainedReaderCount( m_retainedReaderCount );
+        Alembic::AbcCoreAbstract::ArchiveReaderPtr arPtr;
+        try
+        {
+            arPtr = ogawa( iFileName, fid );
+        }
+        catch ( std::exception & )
+        {
+        }
+
+        if ( arPtr )
+        {
+            oType = kOgawa;
+            return Alembic::Abc::IArchive( arPtr, m_policy );
+        }
+
+        oType = kUnknown;
+        return Alembic::Abc::IArchive();
     }
 
+    CloseFile( fid );
+
 #ifdef ALEMBIC_WITH_HDF5
-    Alembic::AbcCoreHDF5::ReadArchive hdf( m_cacheHierarchy );
-    archive = Alembic::Abc::IArchive( hdf, iFileName,
-        Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
-    if ( archive.valid() )
+    // the HDF5 superblock can also be after a user block, so anything that
+    // we could read which isn't Ogawa is given to HDF5 to decide
+    if ( hasHeader )
     {
-        oType = kHDF5;
-        archive.getErrorHandler().setPolicy( m_policy );
-        return archive;
+        Alembic::AbcCoreHDF5::ReadArchive hdf( m_cacheHierarchy );
+        Alembic::Abc::IArchive archive( hdf, iFileName,
+            Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
+        if ( archive.valid() )
+        {
+            oType = kHDF5;
+            archive.getErrorHandler().setPolicy( m_policy );
+            return archive;
+        }
     }
 #else
     // check the first 8 bytes to see if this is an HDF5 file according to
     // www.hdfgroup.org/HDF5/doc/H5.format.html#Superblock
-    std::ifstream filestream;
-    filestream.open(iFileName.c_str(), std::ios::binary);
-
-    if (filestream.is_open())
+    if ( hasHeader && header[0] == '\211' && header[1] == 'H' &&
+         header[2] == 'D' && header[3] == 'F' && header[4] == '\r' &&
+         header[5] == '\n' && header[6] == '\032' && header[7] == '\n' )
     {
-        char bf[8] = {0, 0, 0, 0, 0, 0, 0, 0};
-        filestream.read(bf, 8);
-        filestream.close();
-
-        if (bf[0] == '\211' && bf[1] == 'H' && bf[2] == 'D' && bf[3] == 'F' &&
-            bf[4] == '\r' && bf[5] == '\n' && bf[6] == '\032' && bf[7] == '\n')
-        {
-            oType = kHDF5;
-            return Alembic::Abc::IArchive();
-        }
+        oType = kHDF5;
+        return Alembic::Abc::IArchive();
     }
 #endif
 
@@ -130,6 +495,39 @@ Alembic::Abc::IArchive IFactory::getArchive(
     Alembic::AbcCoreLayer::ArchiveReaderPtrs archives;
 
     // first read our archives, skipping over bad ones
+#ifdef ALEMBIC_FACTORY_PARALLEL_LAYERS
+    // opening is mostly waiting on the file system, so do them all at once
+    // while keeping them in order
+    std::vector< Alembic::AbcCoreAbstract::ArchiveReaderPtr > opened(
+        iFileNames.size() );
+    std::atomic< size_t > next( 0 );
+    LayerOpener opener( *this, iFileNames, opened, next );
+
+    size_t numThreads = std::thread::hardware_concurrency();
+    numThreads = std::min( std::max( numThreads, ( size_t ) 4 ),
+                           iFileNames.size() );
+
+    std::vector< std::thread > threads;
+    for ( size_t i = 1; i < numThreads; ++i )
+    {
+        threads.push_back( std::thread( std::ref( opener ) ) );
+    }
+
+    opener();
+
+    for ( size_t i = 0; i < threads.size(); ++i )
+    {
+        threads[i].join();
+    }
+
+    for ( size_t i = 0; i < opened.size(); ++i )
+    {
+        if ( opened[i] )
+        {
+            archives.push_back( opened[i] );
+        }
+    }
+#else
     std::vector< std::string >::const_iterator it = iFileNames.begin();
     for ( ; it != iFileNames.end(); ++it )
     {
@@ -139,7 +537,7 @@ Alembic::Abc::IArchive IFactory::getArchive(
             archives.push_back( archive.getPtr() );
         }
     }
-
+#endif
 
     if ( ! archives.empty() )
     {
@@ -159,6 +557,7 @@ Alembic::Abc::IArchive IFactory::getArchive(
 {
     // Ogawa is the only one which can do this
     Alembic::AbcCoreOgawa::ReadArchive ogawa( iStreams );
+    ogawa.setRetainedReaderCount( m_retainedReaderCount );
     Alembic::Abc::IArchive archive( ogawa, "", m_policy, m_cachePtr );
     if ( archive.valid() )
     {
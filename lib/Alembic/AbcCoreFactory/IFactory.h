@@ -123,6 +123,22 @@ public:
         m_numStreams = iNumStreams;
     }
 
+    //! Gets how many recently made object and compound property readers
+    //! keep their parsed headers around when opening an Ogawa file
+    size_t getOgawaRetainedReaderCount() const
+    {
+        return m_retainedReaderCount;
+    }
+
+    //! Sets how many of the most recently made object and compound property
+    //! readers keep their parsed headers around after the readers are
+    //! released when opening an Ogawa file, so getting them again doesn't
+    //! go back to the file.  The default is 0, which keeps none.
+    void setOgawaRetainedReaderCount( size_t iCount )
+    {
+        m_retainedReaderCount = iCount;
+    }
+
     //! Gets the error handler policy
     Alembic::Abc::ErrorHandler::Policy getPolicy() { return m_policy; }
 
@@ -132,11 +148,50 @@ public:
         m_policy = iPolicy;
     }
 
+    //! Sets whether opening a single file goes through a process wide
+    //! registry of shared archives, the default is false.
+    //! Files are identified by their canonical path, size and modification
+    //! time along with the settings above that affect how they are opened.
+    //! While an archive from the registry is still alive, opening the same
+    //! file again hands back the same underlying archive instead of reading
+    //! it again.
+    void setUseSharedArchives( bool iUseSharedArchives )
+    {
+        m_useSharedArchives = iUseSharedArchives;
+    }
+
+    //! Gets whether single files are opened through the shared registry
+    bool getUseSharedArchives() const { return m_useSharedArchives; }
+
+    //! Sets how many of the most recently requested shared archives the
+    //! registry keeps open after nothing else references them, so that
+    //! opening the same files over and over doesn't reread them each time.
+    //! The default is 8, 0 closes them as soon as they are unused.
+    static void setSharedArchiveRetainCount( size_t iCount );
+
+    //! Gets how many idle shared archives are kept open
+    static size_t getSharedArchiveRetainCount();
+
+    //! Gets the number of archives in the registry that are currently open
+    static size_t getNumSharedArchives();
+
+    //! Lets go of the idle archives the registry is keeping open, archives
+    //! that are still referenced elsewhere stay shared
+    static void releaseSharedArchives();
+
 private:
+    Alembic::Abc::IArchive getSharedArchive( const std::string & iFileName,
+                                             CoreType & oType );
+
+    Alembic::Abc::IArchive getUnsharedArchive( const std::string & iFileName,
+                                               CoreType & oType );
+
     bool m_cacheHierarchy;
     size_t m_numStreams;
+    size_t m_retainedReaderCount;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
     Alembic::Abc::ErrorHandler::Policy m_policy;
+    bool m_useSharedArchives;
 
 };
 
@@ -56,14 +56,16 @@ OrImpl::OrImpl( ArImplPtr iArchive,
               , m_index( 0 )
               , m_archive( iArchive )
               , m_header( iHeader )
+              , m_objects( iTops )
+              , m_merged( false )
 {
     ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Archive)" );
-    init( iTops );
 }
 
 OrImpl::OrImpl( OrImplPtr iParent, size_t iIndex )
               : m_parent( iParent )
               , m_index( iIndex )
+              , m_merged( false )
 {
     ABCA_ASSERT( m_parent, "Invalid object in OrImpl(OrImplPtr, size_t)" );
 
@@ -74,15 +76,13 @@ OrImpl::OrImpl( OrImplPtr iParent, size_t iIndex )
     std::vector< ObjectAndIndex >  & childVec =
         m_parent->m_children[m_index];
 
-    std::vector< AbcA::ObjectReaderPtr > objVec;
-    objVec.reserve( childVec.size() );
+    m_objects.reserve( childVec.size() );
 
     std::vector< ObjectAndIndex >::iterator it = childVec.begin();
     for ( ; it != childVec.end(); ++it )
     {
-        objVec.push_back( it->first->getChild( it->second ) );
+        m_objects.push_back( it->first->getChild( it->second ) );
     }
-    init( objVec );
 }
 
 //-*****************************************************************************
@@ -112,18 +112,36 @@ AbcA::ObjectReaderPtr OrImpl::getParent()
 //-*****************************************************************************
 AbcA::CompoundPropertyReaderPtr OrImpl::getProperties()
 {
-    return CprImplPtr( new CprImpl( shared_from_this(), m_properties ) );
+    std::vector< AbcA::CompoundPropertyReaderPtr > properties;
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        if ( m_properties.empty() )
+        {
+            m_properties.reserve( m_objects.size() );
+            std::vector< AbcA::ObjectReaderPtr >::iterator it =
+                m_objects.begin();
+            for ( ; it != m_objects.end(); ++it )
+            {
+                m_properties.push_back( (*it)->getProperties() );
+            }
+        }
+        properties = m_properties;
+    }
+
+    return CprImplPtr( new CprImpl( shared_from_this(), properties ) );
 }
 
 //-*****************************************************************************
 size_t OrImpl::getNumChildren()
 {
+    mergeChildren();
     return m_childHeaders.size();
 }
 
 //-*****************************************************************************
 const AbcA::ObjectHeader & OrImpl::getChildHeader( size_t i )
 {
+    mergeChildren();
     ABCA_ASSERT( i < m_childHeaders.size(),
         "Out of range index in OrData::getChildHeader: " << i );
 
@@ -133,6 +151,7 @@ const AbcA::ObjectHeader & OrImpl::getChildHeader( size_t i )
 //-*****************************************************************************
 const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
 {
+    mergeChildren();
     ChildNameMap::iterator findChildItr = m_childNameMap.find( iName );
 
     if( findChildItr != m_childNameMap.end() )
@@ -146,6 +165,7 @@ const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::ObjectReaderPtr OrImpl::getChild( const std::string &iName )
 {
+    mergeChildren();
     ChildNameMap::iterator findChildItr = m_childNameMap.find( iName );
 
     if( findChildItr != m_childNameMap.end() )
@@ -159,6 +179,7 @@ AbcA::ObjectReaderPtr OrImpl::getChild( const std::string &iName )
 
 AbcA::ObjectReaderPtr OrImpl::getChild( size_t i )
 {
+    mergeChildren();
     if ( i < m_childHeaders.size() )
     {
         return OrImplPtr( new OrImpl( shared_from_this(), i ) );
@@ -215,18 +236,22 @@ bool OrImpl::getChildrenHash( Util::Digest & oDigest )
 }
 
 //-*****************************************************************************
-// This layers the children together, and creates
-void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
+// This layers the children together, the objects of every layer are looked at
+// but none of their children are opened until they are asked for.
+void OrImpl::mergeChildren()
 {
+    Alembic::Util::scoped_lock l( m_lock );
 
-    std::vector< AbcA::ObjectReaderPtr >::iterator it =
-        iObjects.begin();
+    if ( m_merged )
+    {
+        return;
+    }
 
-    m_properties.reserve( iObjects.size() );
+    std::vector< AbcA::ObjectReaderPtr >::iterator it =
+        m_objects.begin();
 
-    for ( ; it != iObjects.end(); ++it )
+    for ( ; it != m_objects.end(); ++it )
     {
-        m_properties.push_back( (*it)->getProperties() );
         for ( size_t i = 0; i < (*it)->getNumChildren(); ++i )
         {
             AbcA::ObjectHeader objHeader = (*it)->getChildHeader( i );
@@ -295,6 +320,8 @@ void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
             }
         }
     }
+
+    m_merged = true;
 }
 
 
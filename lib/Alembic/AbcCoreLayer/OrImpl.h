@@ -92,8 +92,9 @@ public:
 
 private:
 
-    // builds up our data
-    void init( std::vector< AbcA::ObjectReaderPtr > & iObjects );
+    // layers the children of m_objects together the first time they are
+    // asked about
+    void mergeChildren();
 
     // The parent object
     OrImplPtr m_parent;
@@ -106,6 +107,13 @@ private:
     // this objects header
     ObjectHeaderPtr m_header;
 
+    // the objects from each layer which make up this object
+    std::vector< AbcA::ObjectReaderPtr > m_objects;
+
+    // guards the lazily built data below
+    Alembic::Util::mutex m_lock;
+    bool m_merged;
+
     // all of our compounded child headers
     std::vector< ObjectHeaderPtr > m_childHeaders;
 
@@ -42,6 +42,8 @@
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <sstream>
+
 using namespace Alembic::Abc;
 
 //-*****************************************************************************
@@ -239,11 +241,74 @@ void replaceTest()
     }
 }
 
+//-*****************************************************************************
+void manyLayersTest()
+{
+    // each odd layer prunes what the layer before it added, which only works
+    // if the layers are kept in order
+    std::vector< std::string > files;
+    for ( size_t i = 0; i < 12; ++i )
+    {
+        std::ostringstream strm;
+        strm << "objectManyLayers" << i << ".abc";
+        files.push_back( strm.str() );
+
+        MetaData md;
+        md.set( "layer", strm.str() );
+
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          files.back() );
+        OObject shared( archive.getTop(), "shared", md );
+
+        std::ostringstream childName;
+        childName << "only" << i;
+        OObject only( shared, childName.str() );
+        OObject grandChild( only, "grandChild" );
+
+        if ( i % 2 == 1 )
+        {
+            std::ostringstream pruneName;
+            pruneName << "only" << i - 1;
+            MetaData pruneMd;
+            Alembic::AbcCoreLayer::SetPrune( pruneMd, true );
+            OObject prune( shared, pruneName.str(), pruneMd );
+        }
+    }
+
+    // bad files in the middle are skipped
+    files.insert( files.begin() + 5, "objectManyLayersMissing.abc" );
+
+    Alembic::AbcCoreFactory::IFactory factory;
+    Alembic::AbcCoreFactory::IFactory::CoreType coreType;
+    IArchive archive = factory.getArchive( files, coreType );
+    TESTING_ASSERT( coreType == Alembic::AbcCoreFactory::IFactory::kLayer );
+
+    TESTING_ASSERT( archive.getTop().getNumChildren() == 1 );
+    IObject shared = archive.getTop().getChild( "shared" );
+    TESTING_ASSERT( shared.getMetaData().get( "layer" ) ==
+                    "objectManyLayers0.abc" );
+
+    TESTING_ASSERT( shared.getNumChildren() == 6 );
+    for ( size_t i = 0; i < 12; ++i )
+    {
+        std::ostringstream childName;
+        childName << "only" << i;
+        IObject only = shared.getChild( childName.str() );
+        TESTING_ASSERT( only.valid() == ( i % 2 == 1 ) );
+        if ( only.valid() )
+        {
+            TESTING_ASSERT( only.getNumChildren() == 1 );
+            TESTING_ASSERT( only.getChild( 0 ).getName() == "grandChild" );
+        }
+    }
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
     layerTest();
     pruneTest();
     replaceTest();
+    manyLayersTest();
     return 0;
 }
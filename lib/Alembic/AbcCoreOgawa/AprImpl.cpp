@@ -50,6 +50,7 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : m_parent( iParent )
   , m_group( iGroup )
   , m_header( iHeader )
+  , m_decodedIndex( 0 )
 {
     // Validate all inputs.
     ABCA_ASSERT( m_parent, "Invalid parent" );
@@ -111,7 +112,25 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    if ( !m_header->isDelta )
+    {
+        ReadArraySample( dims, data, id, m_header->header.getDataType(),
+                         m_header->isCompressed, oSample );
+        return;
+    }
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    Util::Dimensions dimensions;
+    ReadDimensions( dims, data, id, dataType, true, dimensions );
+    oSample = AbcA::AllocateArraySample( dataType, dimensions );
+
+    std::vector< Util::uint8_t > buf;
+    readDeltaSample( index / 2, id, buf );
+    if ( !buf.empty() )
+    {
+        memcpy( const_cast< void * >( oSample->getData() ), &buf.front(),
+                buf.size() );
+    }
 }
 
 //-*****************************************************************************
@@ -155,7 +174,7 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
     {
         if ( data->getSize() >= 16 )
         {
-            oKey.numBytes = data->getSize() - 16;
+            oKey.numBytes = ReadNumBytes( data, id, m_header->isCompressed );
             data->read( 16, oKey.digest.d, 0, id );
         }
 
@@ -184,7 +203,8 @@ void AprImpl::getDimensions( index_t iSampleIndex,
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim );
+    ReadDimensions( dims, data, id, m_header->header.getDataType(),
+                    m_header->isCompressed, oDim );
 
 }
 
@@ -198,8 +218,73 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
+
+    if ( m_header->isDelta )
+    {
+        std::vector< Util::uint8_t > buf;
+        readDeltaSample( index / 2, id, buf );
+        if ( buf.empty() )
+        {
+            return;
+        }
+
+        Util::PlainOldDataType curPod = m_header->header.getDataType().getPod();
+        if ( iPod == curPod )
+        {
+            memcpy( iIntoLocation, &buf.front(), buf.size() );
+        }
+        else
+        {
+            ConvertData( curPod, iPod, ( char * )( &buf.front() ),
+                         iIntoLocation, buf.size() );
+        }
+        return;
+    }
+
     Ogawa::IDataPtr data = m_group->getData( index, id );
-    ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod );
+    ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod,
+              m_header->isCompressed );
+}
+
+//-*****************************************************************************
+void AprImpl::readDeltaSample( size_t iStorageIndex, std::size_t iThreadId,
+                               std::vector< Util::uint8_t > & oBuf )
+{
+    Alembic::Util::scoped_lock l( m_deltaLock );
+
+    // walk back to a key frame, or to the sample we last decoded
+    std::vector< Ogawa::IDataPtr > chain;
+    size_t storageIndex = iStorageIndex;
+    while ( m_decodedIndex != storageIndex + 1 )
+    {
+        Ogawa::IDataPtr data = m_group->getData( storageIndex * 2, iThreadId );
+        ABCA_ASSERT( data, "Missing delta encoded sample data for: " <<
+                     m_header->header.getName() );
+
+        chain.push_back( data );
+
+        Util::uint32_t base = ReadDeltaBase( data, iThreadId );
+        if ( base == 0 )
+        {
+            break;
+        }
+
+        ABCA_ASSERT( base <= storageIndex,
+            "Delta encoded sample refers to a later sample for: " <<
+            m_header->header.getName() );
+        storageIndex = base - 1;
+    }
+
+    // apply them oldest first
+    m_decodedIndex = 0;
+    for ( std::vector< Ogawa::IDataPtr >::reverse_iterator it =
+          chain.rbegin(); it != chain.rend(); ++it )
+    {
+        ReadDeltaData( *it, iThreadId, m_decodedBytes );
+    }
+
+    m_decodedIndex = iStorageIndex + 1;
+    oBuf = m_decodedBytes;
 }
 
 } // End namespace ALEMBIC_VERSION_NS
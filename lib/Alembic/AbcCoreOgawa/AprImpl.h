@@ -76,6 +76,10 @@ public:
 
 private:
 
+    // decodes the delta encoded sample at iStorageIndex into oBuf
+    void readDeltaSample( size_t iStorageIndex, std::size_t iThreadId,
+                          std::vector< Util::uint8_t > & oBuf );
+
     // Parent compound property writer. It must exist.
     AbcA::CompoundPropertyReaderPtr m_parent;
 
@@ -84,6 +88,13 @@ private:
 
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
+
+    // When the samples are delta encoded, the last one we decoded, so that
+    // reading the samples in order only has to apply one delta each time.
+    // m_decodedIndex is the storage index + 1 of it, or 0 if there isn't one.
+    std::vector< Util::uint8_t > m_decodedBytes;
+    size_t m_decodedIndex;
+    Alembic::Util::mutex m_deltaLock;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,8 +35,10 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -46,9 +48,10 @@ namespace ALEMBIC_VERSION_NS {
 ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex ) :
+                  size_t iIndex,
+                  Ogawa::IGroupPtr iExisting ) :
     m_parent( iParent ), m_header( iHeader ), m_group( iGroup ), m_dims( 1 ),
-    m_index( iIndex )
+    m_index( iIndex ), m_deltaBaseIndex( 0 ), m_numDeltas( 0 )
 {
     ABCA_ASSERT( m_parent, "Invalid parent" );
     ABCA_ASSERT( m_header, "Invalid property header" );
@@ -59,6 +62,77 @@ ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
         ABCA_THROW( "Attempted to create a ArrayPropertyWriter from a "
                     "non-array property type" );
     }
+
+    // keep whatever layout the samples were already written with
+    if ( iExisting )
+    {
+        if ( m_header->nextSampleIndex > 0 )
+        {
+            initFromExisting( iExisting );
+        }
+        return;
+    }
+
+    Alembic::Util::PlainOldDataType pod =
+        m_header->header.getDataType().getPod();
+
+    AwImpl *archive = dynamic_cast< AwImpl * >(
+        m_parent->getObject()->getArchive().get() );
+
+    // strings and wstrings are never compressed
+    m_header->isCompressed = archive &&
+        archive->getCompressionHint() >= 0 &&
+        pod != Alembic::Util::kStringPOD && pod != Alembic::Util::kWstringPOD;
+
+    // only floating point data changes little enough from sample to sample
+    // for delta encoding to be worth it
+    m_header->isDelta = m_header->isCompressed &&
+        archive->getDeltaKeyframeInterval() > 0 &&
+        ( pod == Alembic::Util::kFloat16POD ||
+          pod == Alembic::Util::kFloat32POD ||
+          pod == Alembic::Util::kFloat64POD );
+
+    if ( m_header->isDelta )
+    {
+        archive->requireVersion( 3 );
+    }
+    else if ( m_header->isCompressed )
+    {
+        archive->requireVersion( 2 );
+    }
+}
+
+//-*****************************************************************************
+void ApwImpl::initFromExisting( Ogawa::IGroupPtr iExisting )
+{
+    m_hash = HashExistingSamples( iExisting, *m_header );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    size_t lastIndex = m_header->verifyIndex( m_header->nextSampleIndex - 1 );
+
+    // reference the samples and dimensions that are already written
+    Ogawa::ODataPtr lastData;
+    Util::uint64_t numChildren = iExisting->getNumChildren();
+    for ( Util::uint64_t i = 0; i < numChildren; ++i )
+    {
+        Ogawa::ODataPtr data = m_group->addData( iExisting->getData( i, 0 ) );
+        if ( i == lastIndex * 2 )
+        {
+            lastData = data;
+        }
+    }
+
+    ABCA_ASSERT( lastData,
+        "Missing sample data for: " << m_header->header.getName() );
+
+    Ogawa::IDataPtr data = iExisting->getData( lastIndex * 2, 0 );
+    ReadDimensions( iExisting->getData( lastIndex * 2 + 1, 0 ), data, 0,
+                    dataType, m_header->isCompressed, m_dims );
+
+    AbcA::ArraySample::Key key = ReadExistingKey( data, dataType, m_dims );
+    m_previousWrittenSampleID.reset( new WrittenSampleID( key, lastData,
+        dataType.getExtent() * m_dims.numPoints(),
+        m_header->isCompressed ) );
 }
 
 
@@ -183,8 +257,17 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( m_header->isDelta && key.numBytes > 0 )
+        {
+            writeDeltaSample( iSamp, key, awp->getCompressionHint() );
+        }
+        else
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key,
+                           m_header->isCompressed,
+                           awp->getCompressionHint() );
+        }
 
         m_dims = iSamp.getDimensions();
         WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
@@ -225,6 +308,42 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
     m_header->nextSampleIndex ++;
 }
 
+//-*****************************************************************************
+void ApwImpl::writeDeltaSample( const AbcA::ArraySample & iSamp,
+                                const AbcA::ArraySample::Key & iKey,
+                                Util::int8_t iCompressionHint )
+{
+    AwImpl *archive = dynamic_cast< AwImpl * >(
+        m_parent->getObject()->getArchive().get() );
+    ABCA_ASSERT( archive, "Invalid archive" );
+
+    Util::uint32_t interval = archive->getDeltaKeyframeInterval();
+
+    // the data for sample k is at child 2 * k
+    Util::uint32_t storageIndex =
+        static_cast< Util::uint32_t >( m_group->getNumChildren() / 2 );
+
+    const Util::uint8_t * base = NULL;
+    if ( interval > 0 && m_deltaBase.size() == iKey.numBytes &&
+         m_numDeltas + 1 < interval )
+    {
+        base = &m_deltaBase.front();
+        m_numDeltas ++;
+    }
+    else
+    {
+        m_numDeltas = 0;
+    }
+
+    m_previousWrittenSampleID = WriteDeltaData( m_group, iSamp, iKey, base,
+        m_deltaBaseIndex, iCompressionHint );
+
+    const Util::uint8_t * data =
+        static_cast< const Util::uint8_t * >( iSamp.getData() );
+    m_deltaBase.assign( data, data + iKey.numBytes );
+    m_deltaBaseIndex = storageIndex;
+}
+
 //-*****************************************************************************
 AbcA::ArrayPropertyWriterPtr ApwImpl::asArrayPtr()
 {
@@ -53,10 +53,13 @@ protected:
     friend class CpwData;
 
     //-*************************************************************************
+    // iExisting is only valid if this property was already written to the
+    // archive we are appending to, new samples are added after those
     ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Ogawa::IGroupPtr iExisting );
 
     virtual AbcA::ArrayPropertyWriterPtr asArrayPtr();
 
@@ -79,6 +82,12 @@ protected:
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
 private:
+    void initFromExisting( Ogawa::IGroupPtr iExisting );
+
+    void writeDeltaSample( const AbcA::ArraySample & iSamp,
+                           const AbcA::ArraySample::Key & iKey,
+                           Util::int8_t iCompressionHint );
+
     // The parent compound property writer.
     AbcA::CompoundPropertyWriterPtr m_parent;
 
@@ -94,6 +103,13 @@ private:
     AbcA::Dimensions m_dims;
 
     size_t m_index;
+
+    // for delta encoded properties, the last sample we wrote and the storage
+    // index it was written at, and how many deltas have been written since
+    // the last key frame
+    std::vector< Util::uint8_t > m_deltaBase;
+    Util::uint32_t m_deltaBaseIndex;
+    Util::uint32_t m_numDeltas;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -50,6 +50,7 @@ ArImpl::ArImpl( const std::string &iFileName,
   , m_archive( iFileName, iNumStreams )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iNumStreams )
+  , m_pathIndexSweepSize( 1024 )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file: " << m_fileName );
@@ -65,6 +66,7 @@ ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
   : m_archive( iStreams )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iStreams.size() )
+  , m_pathIndexSweepSize( 1024 )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file from provided streams." );
@@ -75,6 +77,44 @@ ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
     init();
 }
 
+//-*****************************************************************************
+ArImpl::ArImpl( const std::string &iFileName,
+                Util::int32_t iFileDescriptor,
+                std::size_t iNumStreams )
+  : m_fileName( iFileName )
+  , m_archive( iFileName, iFileDescriptor, iNumStreams )
+  , m_header( new AbcA::ObjectHeader() )
+  , m_manager( iNumStreams )
+  , m_pathIndexSweepSize( 1024 )
+{
+    ABCA_ASSERT( m_archive.isValid(),
+                 "Could not open as Ogawa file: " << m_fileName );
+
+    ABCA_ASSERT( m_archive.isFrozen(),
+        "Ogawa file not cleanly closed while being written: " << m_fileName );
+
+    init();
+}
+
+//-*****************************************************************************
+ArImpl::ArImpl( const std::string &iFileName,
+                const void * iBuffer, std::size_t iSize )
+  : m_fileName( iFileName )
+  , m_archive( iBuffer, iSize )
+  , m_header( new AbcA::ObjectHeader() )
+  , m_manager( 1 )
+  , m_pathIndexSweepSize( 1024 )
+{
+    ABCA_ASSERT( m_archive.isValid(),
+                 "Could not open as Ogawa data from memory: " << m_fileName );
+
+    ABCA_ASSERT( m_archive.isFrozen(),
+        "Ogawa data in memory not cleanly closed while being written: " <<
+        m_fileName );
+
+    init();
+}
+
 //-*****************************************************************************
 void ArImpl::init()
 {
@@ -169,6 +209,98 @@ AbcA::ObjectReaderPtr ArImpl::getTop()
     return ret;
 }
 
+//-*****************************************************************************
+AbcA::ObjectReaderPtr ArImpl::getObject( const std::string &iFullName )
+{
+    // the names along the path, and the full name of each of those objects
+    std::vector< std::string > names;
+    std::vector< std::string > fullNames;
+
+    std::size_t start = 0;
+    while ( start < iFullName.size() )
+    {
+        std::size_t end = iFullName.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iFullName.size();
+        }
+
+        if ( end > start )
+        {
+            names.push_back( iFullName.substr( start, end - start ) );
+            fullNames.push_back( ( fullNames.empty() ? "" : fullNames.back() )
+                                 + "/" + names.back() );
+        }
+
+        start = end + 1;
+    }
+
+    // start from the deepest object on the path that is still open, an
+    // open object keeps all of its parents open too
+    AbcA::ObjectReaderPtr obj;
+    std::size_t found = names.size();
+    {
+        Alembic::Util::scoped_lock l( m_pathLock );
+        for ( ; found > 0 && !obj; --found )
+        {
+            PathIndex::iterator it = m_pathIndex.find( fullNames[found - 1] );
+            if ( it != m_pathIndex.end() )
+            {
+                obj = it->second.lock();
+            }
+        }
+
+        if ( obj )
+        {
+            ++found;
+        }
+    }
+
+    if ( !obj )
+    {
+        obj = getTop();
+    }
+
+    std::size_t first = found;
+    for ( ; obj && found < names.size(); ++found )
+    {
+        obj = obj->getChild( names[found] );
+        if ( !obj )
+        {
+            return obj;
+        }
+
+        Alembic::Util::scoped_lock l( m_pathLock );
+        m_pathIndex[fullNames[found]] = obj;
+    }
+
+    // only sweep when something was added
+    if ( first < names.size() )
+    {
+        Alembic::Util::scoped_lock l( m_pathLock );
+        if ( m_pathIndex.size() > m_pathIndexSweepSize )
+        {
+            PathIndex::iterator it = m_pathIndex.begin();
+            while ( it != m_pathIndex.end() )
+            {
+                if ( it->second.expired() )
+                {
+                    m_pathIndex.erase( it++ );
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            m_pathIndexSweepSize = std::max( ( std::size_t ) 1024,
+                                             2 * m_pathIndex.size() );
+        }
+    }
+
+    return obj;
+}
+
 //-*****************************************************************************
 AbcA::TimeSamplingPtr ArImpl::getTimeSampling( Util::uint32_t iIndex )
 {
@@ -213,6 +345,12 @@ const std::vector< AbcA::MetaData > & ArImpl::getIndexedMetaData()
     return m_indexMetaData;
 }
 
+//-*****************************************************************************
+Ogawa::IGroupPtr ArImpl::getGroup()
+{
+    return m_archive.getGroup();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
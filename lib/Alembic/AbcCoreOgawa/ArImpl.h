@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
+#include <Alembic/AbcCoreOgawa/ReaderDataCache.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -54,12 +55,21 @@ class ArImpl
 {
 private:
     friend class ReadArchive;
+    friend class AppendArchive;
 
     ArImpl( const std::string &iFileName,
             size_t iNumStreams=1 );
 
     ArImpl( const std::vector< std::istream * > & iStreams );
 
+    // takes ownership of the already opened iFileDescriptor
+    ArImpl( const std::string &iFileName,
+            Util::int32_t iFileDescriptor,
+            size_t iNumStreams );
+
+    ArImpl( const std::string &iFileName,
+            const void * iBuffer, std::size_t iSize );
+
 public:
 
     virtual ~ArImpl();
@@ -73,6 +83,8 @@ public:
 
     virtual AbcA::ObjectReaderPtr getTop();
 
+    virtual AbcA::ObjectReaderPtr getObject( const std::string &iFullName );
+
     virtual AbcA::TimeSamplingPtr getTimeSampling( Util::uint32_t iIndex );
 
     virtual AbcA::ArchiveReaderPtr asArchivePtr();
@@ -104,6 +116,21 @@ public:
 
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
+    // the root Ogawa group, used when appending to this archive
+    Ogawa::IGroupPtr getGroup();
+
+    // How many of the most recently made object and compound property
+    // readers keep their data around after the readers themselves are gone,
+    // 0 (the default) keeps none.
+    void setRetainedReaderCount( std::size_t iCount )
+    { m_readerDataCache.setMaxCount( iCount ); }
+
+    std::size_t getRetainedReaderCount()
+    { return m_readerDataCache.getMaxCount(); }
+
+    void retainReaderData( Alembic::Util::shared_ptr< void > iData )
+    { m_readerDataCache.retain( iData ); }
+
 private:
     void init();
 
@@ -126,8 +153,24 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    ReaderDataCache m_readerDataCache;
+
+    // every object that getObject has found (including the ones on the way
+    // to it) by full name, so later lookups can start from the deepest one
+    // that is still open instead of the top
+    typedef std::map< std::string,
+                      Alembic::Util::weak_ptr< AbcA::ObjectReader > >
+        PathIndex;
+    PathIndex m_pathIndex;
+
+    // expired entries are cleared out when the index grows past this
+    std::size_t m_pathIndexSweepSize;
+    Alembic::Util::mutex m_pathLock;
 };
 
+typedef Alembic::Util::shared_ptr<ArImpl> ArImplPtr;
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
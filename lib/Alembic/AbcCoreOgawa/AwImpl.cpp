@@ -45,11 +45,17 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 AwImpl::AwImpl( const std::string &iFileName,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                bool iPackScalarSamples,
+                Util::uint32_t iDeltaKeyframeInterval )
   : m_fileName( iFileName )
   , m_metaData( iMetaData )
   , m_archive( iFileName )
   , m_metaDataMap( new MetaDataMap() )
+  , m_packScalarSamples( iPackScalarSamples )
+  , m_deltaKeyframeInterval( iDeltaKeyframeInterval )
+  , m_requiredVersion( 0 )
+  , m_version( 0 )
 {
 
     // add default time sampling
@@ -67,10 +73,16 @@ AwImpl::AwImpl( const std::string &iFileName,
 
 //-*****************************************************************************
 AwImpl::AwImpl( std::ostream * iStream,
-                const AbcA::MetaData &iMetaData )
+                const AbcA::MetaData &iMetaData,
+                bool iPackScalarSamples,
+                Util::uint32_t iDeltaKeyframeInterval )
   : m_metaData( iMetaData )
   , m_archive( iStream )
   , m_metaDataMap( new MetaDataMap() )
+  , m_packScalarSamples( iPackScalarSamples )
+  , m_deltaKeyframeInterval( iDeltaKeyframeInterval )
+  , m_requiredVersion( 0 )
+  , m_version( 0 )
 {
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
@@ -85,13 +97,95 @@ AwImpl::AwImpl( std::ostream * iStream,
     init();
 }
 
+//-*****************************************************************************
+AwImpl::AwImpl( std::vector< char > * iBuffer,
+                const AbcA::MetaData &iMetaData,
+                bool iPackScalarSamples,
+                Util::uint32_t iDeltaKeyframeInterval )
+  : m_metaData( iMetaData )
+  , m_archive( iBuffer )
+  , m_metaDataMap( new MetaDataMap() )
+  , m_packScalarSamples( iPackScalarSamples )
+  , m_deltaKeyframeInterval( iDeltaKeyframeInterval )
+  , m_requiredVersion( 0 )
+  , m_version( 0 )
+{
+    // add default time sampling
+    AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
+    m_timeSamples.push_back(ts);
+    m_maxSamples.push_back(0);
+
+    if ( !m_archive.isValid() )
+    {
+        ABCA_THROW( "Could not use the given memory buffer." );
+    }
+
+    init();
+}
+
+//-*****************************************************************************
+AwImpl::AwImpl( const std::string &iFileName,
+                const AbcA::MetaData &iMetaData,
+                bool iPackScalarSamples,
+                ArImplPtr iExisting )
+  : m_fileName( iFileName )
+  , m_metaData( iExisting->getMetaData() )
+  , m_archive( iFileName, true )
+  , m_metaDataMap( new MetaDataMap() )
+  , m_packScalarSamples( iPackScalarSamples )
+  , m_deltaKeyframeInterval( 0 )
+  , m_requiredVersion( 0 )
+  , m_version( 0 )
+  , m_existing( iExisting )
+{
+    // start with everything the existing archive already knows about
+    Util::uint32_t numSamplings = m_existing->getNumTimeSamplings();
+    for ( Util::uint32_t i = 0; i < numSamplings; ++i )
+    {
+        m_timeSamples.push_back( m_existing->getTimeSampling( i ) );
+        m_maxSamples.push_back(
+            m_existing->getMaxNumSamplesForTimeSamplingIndex( i ) );
+    }
+
+    for ( AbcA::MetaData::const_iterator it = iMetaData.begin();
+          it != iMetaData.end(); ++it )
+    {
+        m_metaData.set( it->first, it->second );
+    }
+
+    m_metaDataMap->seed( m_existing->getIndexedMetaData() );
+
+    if ( !m_archive.isValid() )
+    {
+        ABCA_THROW( "Could not open file for appending: " << m_fileName );
+    }
+
+    init();
+}
+
 //-*****************************************************************************
 void AwImpl::init()
 {
     // set the version using Ogawa native calls
     // This expresses the AbcCoreOgawa version - how properties,
     // are stored within Ogawa, etc.
-    Util::int32_t version = ALEMBIC_OGAWA_FILE_VERSION;
+    // We only claim the newer versions if we are going to write packed scalar
+    // or compressed (and delta encoded) array samples so that older libraries
+    // can still read everything else.  Compression and delta encoding raise
+    // it when we are done, see ~AwImpl
+    Util::int32_t version = 0;
+    Ogawa::IGroupPtr existingGroup;
+    if ( m_existing )
+    {
+        existingGroup = m_existing->getGroup();
+        existingGroup->getData( 0, 0 )->read( 4, &version, 0, 0 );
+    }
+
+    if ( m_packScalarSamples && version < 1 )
+    {
+        version = 1;
+    }
+    m_version = version;
     m_archive.getGroup()->addData( 4, &version );
 
     // This is the Alembic library version XXYYZZ
@@ -102,7 +196,16 @@ void AwImpl::init()
 
     m_metaData.set("_ai_AlembicVersion", AbcA::GetLibraryVersion());
 
-    m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
+    if ( existingGroup )
+    {
+        m_data.reset( new OwData( m_archive.getGroup()->addGroup(),
+                                  existingGroup->getGroup( 2, false, 0 ),
+                                  "/", m_existing ) );
+    }
+    else
+    {
+        m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
+    }
 
     // seed with the common empty keys
     AbcA::ArraySampleKey emptyKey;
@@ -232,6 +335,14 @@ AwImpl::~AwImpl()
     // encode and write the time samplings and max samples into data
     if ( m_archive.isValid() )
     {
+        // the compression hint can be set after the version was written,
+        // the root group isn't frozen yet so we can still replace it
+        if ( m_requiredVersion > m_version )
+        {
+            m_archive.getGroup()->replaceData( 0,
+                m_archive.getGroup()->createData( 4, &m_requiredVersion ) );
+        }
+
         // encode and write the Metadata for the archive, since the top level
         // meta data can be kinda big and is very specialized don't worry
         // about putting it into the meta data map
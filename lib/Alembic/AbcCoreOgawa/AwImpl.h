@@ -40,6 +40,7 @@
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -55,12 +56,28 @@ class AwImpl : public AbcA::ArchiveWriter
 {
 private:
     friend class WriteArchive;
+    friend class AppendArchive;
 
     AwImpl( const std::string &iFileName,
-            const AbcA::MetaData &iMetaData );
+            const AbcA::MetaData &iMetaData,
+            bool iPackScalarSamples,
+            Util::uint32_t iDeltaKeyframeInterval );
 
     AwImpl( std::ostream * iStream,
-            const AbcA::MetaData & iMetaData );
+            const AbcA::MetaData & iMetaData,
+            bool iPackScalarSamples,
+            Util::uint32_t iDeltaKeyframeInterval );
+
+    AwImpl( std::vector< char > * iBuffer,
+            const AbcA::MetaData & iMetaData,
+            bool iPackScalarSamples,
+            Util::uint32_t iDeltaKeyframeInterval );
+
+    // append to the file that iExisting has already opened and validated
+    AwImpl( const std::string &iFileName,
+            const AbcA::MetaData & iMetaData,
+            bool iPackScalarSamples,
+            ArImplPtr iExisting );
 
 public:
     virtual ~AwImpl();
@@ -89,6 +106,34 @@ public:
         return m_metaDataMap;
     }
 
+    bool getPackScalarSamples() const
+    {
+        return m_packScalarSamples;
+    }
+
+    // 0 if array samples aren't delta encoded, see WriteArchive
+    Util::uint32_t getDeltaKeyframeInterval() const
+    {
+        return m_deltaKeyframeInterval;
+    }
+
+    // called when a property is going to write samples that need at least
+    // iVersion to be read, the file version will be raised to it when we
+    // are done
+    void requireVersion( Util::int32_t iVersion )
+    {
+        if ( iVersion > m_requiredVersion )
+        {
+            m_requiredVersion = iVersion;
+        }
+    }
+
+    // the archive being appended to, NULL if we are writing a new one
+    ArImplPtr getExistingArchive()
+    {
+        return m_existing;
+    }
+
     virtual Util::uint32_t addTimeSampling( const AbcA::TimeSampling & iTs );
 
     virtual AbcA::TimeSamplingPtr getTimeSampling( Util::uint32_t iIndex );
@@ -117,6 +162,17 @@ private:
 
     WrittenSampleMap m_writtenSampleMap;
     MetaDataMapPtr m_metaDataMap;
+
+    bool m_packScalarSamples;
+
+    Util::uint32_t m_deltaKeyframeInterval;
+
+    Util::int32_t m_requiredVersion;
+
+    // the AbcCoreOgawa version that was written at the start of the archive
+    Util::int32_t m_version;
+
+    ArImplPtr m_existing;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
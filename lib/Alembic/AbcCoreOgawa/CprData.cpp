@@ -245,16 +245,29 @@ CprData::getCompoundProperty( AbcA::CompoundPropertyReaderPtr iParent,
 
         StreamIDPtr streamId = implPtr->getStreamID();
 
-        Ogawa::IGroupPtr group = m_group->getGroup( fiter->second, false,
-                                                    streamId->getID() );
+        // reuse the data from the last one if it's still around
+        CprDataPtr data = sub.data.lock();
 
-        ABCA_ASSERT( group, "Compound Property not backed by a valid group.");
+        Ogawa::IGroupPtr group;
+        if ( !data )
+        {
+            group = m_group->getGroup( fiter->second, false,
+                                       streamId->getID() );
+
+            ABCA_ASSERT( group,
+                         "Compound Property not backed by a valid group.");
+        }
 
         // Make a new one.
-        bptr = Alembic::Util::shared_ptr<CprImpl>(
-            new CprImpl( iParent, group, sub.header, streamId->getID(),
-                         implPtr->getIndexedMetaData() ) );
+        Alembic::Util::shared_ptr< CprImpl > impl( new CprImpl( iParent,
+            group, sub.header, streamId->getID(),
+            implPtr->getIndexedMetaData(), data ) );
+
+        data = impl->getData();
+        sub.data = data;
+        implPtr->retainReaderData( data );
 
+        bptr = impl;
         sub.made = bptr;
     }
 
@@ -85,6 +85,11 @@ private:
     {
         PropertyHeaderPtr header;
         WeakBprPtr made;
+
+        // for compound properties, the data of the last reader that was
+        // made, which lives on after the reader if the archive is
+        // retaining reader data
+        Alembic::Util::weak_ptr< CprData > data;
         Alembic::Util::mutex lock;
     };
 
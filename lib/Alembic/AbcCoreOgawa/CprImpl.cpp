@@ -51,9 +51,11 @@ CprImpl::CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
                   Ogawa::IGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
                   std::size_t iThreadId,
-                  const std::vector< AbcA::MetaData > & iIndexedMetaData )
+                  const std::vector< AbcA::MetaData > & iIndexedMetaData,
+                  CprDataPtr iData )
     : m_parent( iParent )
     , m_header( iHeader )
+    , m_data( iData )
 {
     ABCA_ASSERT( m_parent, "Invalid parent in CprImpl(Compound)" );
     ABCA_ASSERT( m_header, "invalid header in CprImpl(Compound)" );
@@ -70,8 +72,12 @@ CprImpl::CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
     ABCA_ASSERT( optr, "Invalid object in CprImpl::CprImpl(Compound)" );
     m_object = optr;
 
-    m_data.reset( new CprData( iGroup, iThreadId, *( m_object->getArchive() ),
-                               iIndexedMetaData ) );
+    if ( !m_data )
+    {
+        m_data.reset( new CprData( iGroup, iThreadId,
+                                   *( m_object->getArchive() ),
+                                   iIndexedMetaData ) );
+    }
 }
 
 //-*****************************************************************************
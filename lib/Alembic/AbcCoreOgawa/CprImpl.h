@@ -51,12 +51,15 @@ class CprImpl
 {
 public:
 
-    // For construction from a compound property reader
+    // For construction from a compound property reader, iData is the
+    // previously read data for this property, if it is empty the data is
+    // read from iGroup
     CprImpl( AbcA::CompoundPropertyReaderPtr iParent,
              Ogawa::IGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
              std::size_t iThreadId,
-             const std::vector< AbcA::MetaData > & iIndexedMetaData );
+             const std::vector< AbcA::MetaData > & iIndexedMetaData,
+             CprDataPtr iData = CprDataPtr() );
 
     CprImpl( AbcA::ObjectReaderPtr iParent,
              CprDataPtr iData );
@@ -93,6 +96,7 @@ public:
     virtual AbcA::CompoundPropertyReaderPtr
     getCompoundProperty( const std::string &iName );
 
+    CprDataPtr getData() const { return m_data; }
 
 private:
 
@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcCoreOgawa/CpwData.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/SpwImpl.h>
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
@@ -51,6 +52,40 @@ CpwData::CpwData( Ogawa::OGroupPtr iGroup )
 {
 }
 
+//-*****************************************************************************
+CpwData::CpwData( Ogawa::OGroupPtr iGroup,
+                  Ogawa::IGroupPtr iExisting,
+                  ArImplPtr iExistingArchive )
+    : m_group( iGroup )
+    , m_existingArchive( iExistingArchive )
+{
+    ABCA_ASSERT( iExisting && m_existingArchive, "Invalid existing group" );
+
+    // an empty compound doesn't even have the property headers
+    Util::uint64_t numChildren = iExisting->getNumChildren();
+    if ( numChildren > 0 )
+    {
+        ReadPropertyHeaders( iExisting, numChildren - 1, 0,
+                             *m_existingArchive,
+                             m_existingArchive->getIndexedMetaData(),
+                             m_propertyHeaders );
+    }
+
+    // reserve a spot for each existing property so new ones come after
+    for ( size_t i = 0; i < m_propertyHeaders.size(); ++i )
+    {
+        ExistingProperty prop;
+        prop.existing = iExisting->getGroup( i, false, 0 );
+        prop.group = m_group->addGroup();
+        prop.made = false;
+        m_existingProperties.push_back( prop );
+        m_existingIndices[m_propertyHeaders[i]->header.getName()] = i;
+
+        m_hashes.push_back(0);
+        m_hashes.push_back(0);
+    }
+}
+
 //-*****************************************************************************
 CpwData::~CpwData()
 {
@@ -95,12 +130,46 @@ CpwData::getPropertyHeader( const std::string &iName )
 
 //-*****************************************************************************
 AbcA::BasePropertyWriterPtr
-CpwData::getProperty( const std::string &iName )
+CpwData::getProperty( AbcA::CompoundPropertyWriterPtr iParent,
+                      const std::string &iName )
 {
     MadeProperties::iterator fiter = m_madeProperties.find( iName );
     if ( fiter == m_madeProperties.end() )
     {
-        return AbcA::BasePropertyWriterPtr();
+        // lazily make writers for the properties we are appending to
+        std::map< std::string, size_t >::iterator eiter =
+            m_existingIndices.find( iName );
+        if ( eiter == m_existingIndices.end() )
+        {
+            return AbcA::BasePropertyWriterPtr();
+        }
+
+        size_t i = eiter->second;
+        PropertyHeaderPtr header = m_propertyHeaders[i];
+        ExistingProperty & prop = m_existingProperties[i];
+        prop.made = true;
+
+        AbcA::BasePropertyWriterPtr ret;
+        if ( header->header.isScalar() )
+        {
+            ret.reset( new SpwImpl( iParent, prop.group, header, i,
+                                    prop.existing ) );
+        }
+        else if ( header->header.isArray() )
+        {
+            ret.reset( new ApwImpl( iParent, prop.group, header, i,
+                                    prop.existing ) );
+        }
+        else
+        {
+            ret.reset( new CpwImpl( iParent, prop.group, header, i,
+                                    prop.existing ) );
+        }
+
+        prop.group.reset();
+        prop.existing.reset();
+        m_madeProperties[iName] = WeakBpwPtr( ret );
+        return ret;
     }
 
     WeakBpwPtr wptr = (*fiter).second;
@@ -116,7 +185,7 @@ CpwData::createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
                                const AbcA::DataType & iDataType,
                                Util::uint32_t iTimeSamplingIndex )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) || m_existingIndices.count( iName ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -139,7 +208,7 @@ CpwData::createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
 
     Alembic::Util::shared_ptr<SpwImpl>
         ret( new SpwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+                          m_propertyHeaders.size(), Ogawa::IGroupPtr() ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
@@ -158,7 +227,7 @@ CpwData::createArrayProperty( AbcA::CompoundPropertyWriterPtr iParent,
                               const AbcA::DataType & iDataType,
                               Util::uint32_t iTimeSamplingIndex )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) || m_existingIndices.count( iName ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -181,7 +250,7 @@ CpwData::createArrayProperty( AbcA::CompoundPropertyWriterPtr iParent,
 
     Alembic::Util::shared_ptr<ApwImpl>
         ret( new ApwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+                          m_propertyHeaders.size(), Ogawa::IGroupPtr() ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
@@ -198,7 +267,7 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
                                  const std::string & iName,
                                  const AbcA::MetaData & iMetaData )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) || m_existingIndices.count( iName ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -208,7 +277,7 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
 
     Alembic::Util::shared_ptr<CpwImpl>
         ret( new CpwImpl( iParent, m_group->addGroup(), headerPtr,
-                          m_propertyHeaders.size() ) );
+                          m_propertyHeaders.size(), Ogawa::IGroupPtr() ) );
 
     m_propertyHeaders.push_back( headerPtr );
     m_madeProperties[iName] = WeakBpwPtr( ret );
@@ -231,6 +300,9 @@ void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
                            prop->header,
                            prop->isScalarLike,
                            prop->isHomogenous,
+                           prop->isPacked,
+                           prop->isCompressed,
+                           prop->isDelta,
                            prop->timeSamplingIndex,
                            prop->nextSampleIndex,
                            prop->firstChangedIndex,
@@ -257,6 +329,26 @@ void CpwData::fillHash( size_t iIndex, Util::uint64_t iHash0,
     m_hashes[ iIndex * 2 + 1 ] = iHash1;
 }
 
+//-*****************************************************************************
+void CpwData::finishExistingProperties()
+{
+    for ( size_t i = 0; i < m_existingProperties.size(); ++i )
+    {
+        ExistingProperty & prop = m_existingProperties[i];
+        if ( !prop.made )
+        {
+            CopyExistingGroup( prop.group, prop.existing );
+            HashExistingProperty( prop.existing, *m_propertyHeaders[i],
+                                  *m_existingArchive,
+                                  m_existingArchive->getIndexedMetaData(),
+                                  m_hashes[i * 2], m_hashes[i * 2 + 1] );
+            prop.group.reset();
+            prop.existing.reset();
+            prop.made = true;
+        }
+    }
+}
+
 //-*****************************************************************************
 void CpwData::computeHash( Util::SpookyHash & ioHash )
 {
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/MetaDataMap.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -53,6 +54,12 @@ public:
 
     CpwData( Ogawa::OGroupPtr iGroup );
 
+    // for a compound that was already written to the archive we are
+    // appending to
+    CpwData( Ogawa::OGroupPtr iGroup,
+             Ogawa::IGroupPtr iExisting,
+             ArImplPtr iExistingArchive );
+
     ~CpwData();
 
     size_t getNumProperties();
@@ -61,7 +68,9 @@ public:
 
     const AbcA::PropertyHeader * getPropertyHeader( const std::string &iName );
 
-    AbcA::BasePropertyWriterPtr getProperty( const std::string & iName );
+    AbcA::BasePropertyWriterPtr getProperty(
+        AbcA::CompoundPropertyWriterPtr iParent,
+        const std::string & iName );
 
     AbcA::ScalarPropertyWriterPtr
     createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
@@ -89,6 +98,10 @@ public:
 
     void computeHash( Util::SpookyHash & ioHash );
 
+    // reference the existing properties nobody asked for and fill in
+    // their hashes, call before computeHash and writePropertyHeaders
+    void finishExistingProperties();
+
 private:
 
     // The group corresponding to this property.
@@ -101,6 +114,22 @@ private:
 
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
+
+    // The properties which were already written to the archive we are
+    // appending to, they come first and are only rewritten if asked for.
+    struct ExistingProperty
+    {
+        Ogawa::IGroupPtr existing;
+        Ogawa::OGroupPtr group;
+        bool made;
+    };
+
+    std::vector< ExistingProperty > m_existingProperties;
+
+    // name to index of the existing properties
+    std::map< std::string, size_t > m_existingIndices;
+
+    ArImplPtr m_existingArchive;
 };
 
 typedef Alembic::Util::shared_ptr<CpwData> CpwDataPtr;
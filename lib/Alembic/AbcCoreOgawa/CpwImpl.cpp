@@ -62,7 +62,8 @@ CpwImpl::CpwImpl( AbcA::ObjectWriterPtr iParent,
 CpwImpl::CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex )
+                  size_t iIndex,
+                  Ogawa::IGroupPtr iExisting )
   : m_parent( iParent )
   , m_header( iHeader )
   , m_index( iIndex )
@@ -79,7 +80,18 @@ CpwImpl::CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                  m_header->header.getName().find('/') == std::string::npos,
                  "Invalid name" );
 
-    m_data.reset( new CpwData( iGroup ) );
+    if ( iExisting )
+    {
+        ArImplPtr existingArchive = Alembic::Util::dynamic_pointer_cast<
+            AwImpl, AbcA::ArchiveWriter >(
+                m_object->getArchive() )->getExistingArchive();
+
+        m_data.reset( new CpwData( iGroup, iExisting, existingArchive ) );
+    }
+    else
+    {
+        m_data.reset( new CpwData( iGroup ) );
+    }
 }
 
 //-*****************************************************************************
@@ -92,6 +104,7 @@ CpwImpl::~CpwImpl()
         MetaDataMapPtr mdMap = Alembic::Util::dynamic_pointer_cast<
             AwImpl, AbcA::ArchiveWriter >(
                 getObject()->getArchive() )->getMetaDataMap();
+        m_data->finishExistingProperties();
         m_data->writePropertyHeaders( mdMap );
 
         Util::SpookyHash hash;
@@ -155,7 +168,7 @@ CpwImpl::getPropertyHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::BasePropertyWriterPtr CpwImpl::getProperty( const std::string & iName )
 {
-    return m_data->getProperty( iName );
+    return m_data->getProperty( asCompoundPtr(), iName );
 }
 
 //-*****************************************************************************
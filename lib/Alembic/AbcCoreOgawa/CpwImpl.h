@@ -56,11 +56,13 @@ public:
              CpwDataPtr iData,
              const AbcA::MetaData & iMeta );
 
-    // child compound creation
+    // child compound creation, iExisting is only valid if this compound was
+    // already written to the archive we are appending to
     CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Ogawa::IGroupPtr iExisting );
 
     virtual ~CpwImpl();
 
@@ -54,7 +54,13 @@
 #include <assert.h>
 #include <string.h>
 
-#define ALEMBIC_OGAWA_FILE_VERSION 0
+// Version 1 adds scalar properties whose samples are packed together into
+// a single data block, it is only written when the archive was asked to pack.
+// Version 2 adds array properties whose samples may be compressed, it is only
+// written when a compression hint was used.
+// Version 3 adds array properties whose samples may be delta encoded against
+// an earlier sample, it is only written when delta encoding was used.
+#define ALEMBIC_OGAWA_FILE_VERSION 3
 
 //-*****************************************************************************
 
@@ -82,6 +88,9 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isPacked = false;
+        isCompressed = false;
+        isDelta = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -95,6 +104,9 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isPacked = false;
+        isCompressed = false;
+        isDelta = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -113,6 +125,9 @@ struct PropertyHeaderAndFriends
     {
         isScalarLike = true;
         isHomogenous = true;
+        isPacked = false;
+        isCompressed = false;
+        isDelta = false;
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
@@ -154,6 +169,19 @@ struct PropertyHeaderAndFriends
 
     bool isHomogenous;
 
+    // Whether all of the samples of a scalar property are stored back to
+    // back in one data block instead of one data block per sample
+    bool isPacked;
+
+    // Whether each sample of an array property is stored as the key, the
+    // uncompressed size of the data, and then the (possibly compressed) data
+    bool isCompressed;
+
+    // Whether this compressed array property also stores, after the
+    // uncompressed size, the storage index + 1 of the sample each sample
+    // was XORed against before compressing (0 for a key frame)
+    bool isDelta;
+
     // Index of the next sample to write
     Util::uint32_t nextSampleIndex;
 
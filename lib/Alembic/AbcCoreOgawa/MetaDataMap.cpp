@@ -107,6 +107,17 @@ void MetaDataMap::write( Ogawa::OGroupPtr iParent )
     iParent->addData( buf.size(), ( const void * )&buf.front() );
 }
 
+//-*****************************************************************************
+void MetaDataMap::seed( const std::vector< AbcA::MetaData > & iIndexedMetaData )
+{
+    // index 0 is always the empty meta data, so it isn't in the map
+    for ( size_t i = 1; i < iIndexedMetaData.size() && m_map.size() < 254;
+          ++i )
+    {
+        m_map[ iIndexedMetaData[i].serialize() ] = i - 1;
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -56,6 +56,10 @@ public:
     // 0 will be returned if iStr is empty
     Util::uint32_t getIndex( const std::string & iStr );
     void write( Ogawa::OGroupPtr iParent );
+
+    // when appending to an archive, start with the meta data it already
+    // indexed so that the indices in the existing headers stay valid
+    void seed( const std::vector< AbcA::MetaData > & iIndexedMetaData );
 private:
     std::map< std::string, Util::uint32_t > m_map;
 };
@@ -161,15 +161,55 @@ OrData::getChild( AbcA::ObjectReaderPtr iParent, size_t i )
     ABCA_ASSERT( i < m_childrenMap.size(),
         "Out of range index in OrData::getChild: " << i );
 
-    Alembic::Util::scoped_lock l( m_children[i].lock );
-    AbcA::ObjectReaderPtr optr = m_children[i].made.lock();
+    Child & child = m_children[i];
+
+#ifdef ALEMBIC_OGAWA_ATOMIC_CHILDREN
+    // Most of the time the child is already around.
+    Alembic::Util::shared_ptr< WeakOrPtr > made =
+        std::atomic_load( &child.made );
+    AbcA::ObjectReaderPtr optr;
+    if ( made )
+    {
+        optr = made->lock();
+    }
+
+    if ( optr )
+    {
+        return optr;
+    }
+
+    Alembic::Util::scoped_lock l( child.lock );
+
+    // another thread may have made it while we were waiting
+    made = std::atomic_load( &child.made );
+    if ( made )
+    {
+        optr = made->lock();
+    }
+#else
+    Alembic::Util::scoped_lock l( child.lock );
+    AbcA::ObjectReaderPtr optr = child.made.lock();
+#endif
 
     if ( ! optr )
     {
-        // Make a new one.
-        optr = Alembic::Util::shared_ptr<OrImpl>(
-            new OrImpl( iParent, m_group, i + 1, m_children[i].header ) );
-        m_children[i].made = optr;
+        // Make a new one, reusing the data from the last one if it's still
+        // around.
+        Alembic::Util::shared_ptr< OrImpl > impl( new OrImpl( iParent,
+            m_group, i + 1, child.header, child.data.lock() ) );
+
+        OrDataPtr data = impl->getData();
+        child.data = data;
+        impl->getArchiveImpl()->retainReaderData( data );
+
+        optr = impl;
+
+#ifdef ALEMBIC_OGAWA_ATOMIC_CHILDREN
+        std::atomic_store( &child.made, Alembic::Util::shared_ptr<
+            WeakOrPtr >( new WeakOrPtr( optr ) ) );
+#else
+        child.made = optr;
+#endif
     }
 
     return optr;
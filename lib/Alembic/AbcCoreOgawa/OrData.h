@@ -39,6 +39,13 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 
+// with C++11 atomic shared_ptr access, children which have already been
+// made are gotten without taking their lock
+#if !defined(ALEMBIC_LIB_USES_TR1) && !defined(ALEMBIC_LIB_USES_BOOST) && \
+    __cplusplus >= 201103L
+#define ALEMBIC_OGAWA_ATOMIC_CHILDREN
+#endif
+
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
@@ -87,7 +94,20 @@ private:
     struct Child
     {
         ObjectHeaderPtr header;
+
+#ifdef ALEMBIC_OGAWA_ATOMIC_CHILDREN
+        // The last reader that was made.  The holder is never changed in
+        // place, it is only replaced with std::atomic_store while holding
+        // lock, so std::atomic_load can get it without the lock.  Whoever
+        // loaded the old holder keeps it alive.
+        Alembic::Util::shared_ptr< WeakOrPtr > made;
+#else
         WeakOrPtr made;
+#endif
+
+        // the data of the last reader that was made, which lives on
+        // after the reader if the archive is retaining reader data
+        Alembic::Util::weak_ptr< OrData > data;
         Alembic::Util::mutex lock;
     };
 
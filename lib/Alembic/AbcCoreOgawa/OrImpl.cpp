@@ -52,8 +52,10 @@ namespace ALEMBIC_VERSION_NS {
 OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
                 Ogawa::IGroupPtr iParentGroup,
                 std::size_t iGroupIndex,
-                ObjectHeaderPtr iHeader )
-    : m_header( iHeader )
+                ObjectHeaderPtr iHeader,
+                OrDataPtr iData )
+    : m_data( iData )
+    , m_header( iHeader )
 {
     m_parent = Alembic::Util::dynamic_pointer_cast< OrImpl,
         AbcA::ObjectReader > (iParent);
@@ -65,11 +67,15 @@ OrImpl::OrImpl( AbcA::ObjectReaderPtr iParent,
     m_archive = m_parent->getArchiveImpl();
     ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Object)" );
 
-    StreamIDPtr streamId = m_archive->getStreamID();
-    std::size_t id = streamId->getID();
-    Ogawa::IGroupPtr group = iParentGroup->getGroup( iGroupIndex, false, id );
-    m_data.reset( new OrData( group, iHeader->getFullName(), id,
-        *m_archive, m_archive->getIndexedMetaData() ) );
+    if ( !m_data )
+    {
+        StreamIDPtr streamId = m_archive->getStreamID();
+        std::size_t id = streamId->getID();
+        Ogawa::IGroupPtr group = iParentGroup->getGroup( iGroupIndex, false,
+                                                         id );
+        m_data.reset( new OrData( group, iHeader->getFullName(), id,
+            *m_archive, m_archive->getIndexedMetaData() ) );
+    }
 }
 
 //-*****************************************************************************
@@ -57,10 +57,13 @@ public:
             OrDataPtr iData,
             ObjectHeaderPtr iHeader );
 
+    // iData is the previously read data for this object, if it is empty
+    // the data is read from iParentGroup
     OrImpl( AbcA::ObjectReaderPtr iParent,
             Ogawa::IGroupPtr iParentGroup,
             std::size_t iIndex,
-            ObjectHeaderPtr iHeader );
+            ObjectHeaderPtr iHeader,
+            OrDataPtr iData = OrDataPtr() );
 
     virtual ~OrImpl();
 
@@ -92,10 +95,12 @@ public:
 
     virtual bool getChildrenHash( Util::Digest & oDigest );
 
-private:
-
     Alembic::Util::shared_ptr< ArImpl > getArchiveImpl() const;
 
+    OrDataPtr getData() const { return m_data; }
+
+private:
+
     // The parent object
     Alembic::Util::shared_ptr< OrImpl > m_parent;
 
@@ -40,6 +40,7 @@
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -55,6 +56,52 @@ OwData::OwData( Ogawa::OGroupPtr iGroup ) : m_group( iGroup )
         new CpwData( m_group->addGroup() ) );
 }
 
+//-*****************************************************************************
+OwData::OwData( Ogawa::OGroupPtr iGroup,
+                Ogawa::IGroupPtr iExisting,
+                const std::string & iFullName,
+                ArImplPtr iExistingArchive )
+    : m_group( iGroup )
+    , m_existingArchive( iExistingArchive )
+{
+    ABCA_ASSERT( m_group, "Invalid parent group" );
+    ABCA_ASSERT( iExisting && m_existingArchive, "Invalid existing group" );
+
+    Util::uint64_t numChildren = iExisting->getNumChildren();
+    ABCA_ASSERT( numChildren > 1 && iExisting->isChildGroup( 0 ) &&
+                 iExisting->isChildData( numChildren - 1 ),
+                 "Invalid existing object: " << iFullName );
+
+    m_data = Alembic::Util::shared_ptr<CpwData>(
+        new CpwData( m_group->addGroup(), iExisting->getGroup( 0, false, 0 ),
+                     m_existingArchive ) );
+
+    // the full names are built from the parent name plus /
+    std::string parentName = iFullName;
+    if ( parentName == "/" )
+    {
+        parentName = "";
+    }
+
+    ReadObjectHeaders( iExisting, numChildren - 1, 0, parentName,
+                       m_existingArchive->getIndexedMetaData(),
+                       m_childHeaders );
+
+    // reserve a spot for each existing child so that new children come after
+    for ( size_t i = 0; i < m_childHeaders.size(); ++i )
+    {
+        ExistingChild child;
+        child.existing = iExisting->getGroup( i + 1, false, 0 );
+        child.group = m_group->addGroup();
+        child.made = false;
+        m_existingChildren.push_back( child );
+        m_existingIndices[m_childHeaders[i]->getName()] = i;
+
+        m_hashes.push_back(0);
+        m_hashes.push_back(0);
+    }
+}
+
 //-*****************************************************************************
 OwData::~OwData()
 {
@@ -112,12 +159,31 @@ const AbcA::ObjectHeader * OwData::getChildHeader( const std::string &iName )
 }
 
 //-*****************************************************************************
-AbcA::ObjectWriterPtr OwData::getChild( const std::string &iName )
+AbcA::ObjectWriterPtr OwData::getChild( AbcA::ObjectWriterPtr iParent,
+                                        const std::string &iName )
 {
     MadeChildren::iterator fiter = m_madeChildren.find( iName );
     if ( fiter == m_madeChildren.end() )
     {
-        return AbcA::ObjectWriterPtr();
+        // lazily make writers for the children we are appending to
+        std::map< std::string, size_t >::iterator eiter =
+            m_existingIndices.find( iName );
+        if ( eiter == m_existingIndices.end() )
+        {
+            return AbcA::ObjectWriterPtr();
+        }
+
+        size_t i = eiter->second;
+        ExistingChild & child = m_existingChildren[i];
+        child.made = true;
+
+        Alembic::Util::shared_ptr<OwImpl> ret( new OwImpl( iParent,
+            child.group, m_childHeaders[i], i, child.existing ) );
+
+        child.group.reset();
+        child.existing.reset();
+        m_madeChildren[iName] = WeakOwPtr( ret );
+        return ret;
     }
 
     WeakOwPtr wptr = (*fiter).second;
@@ -131,7 +197,7 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
 {
     std::string name = iHeader.getName();
 
-    if ( m_madeChildren.count( name ) )
+    if ( m_madeChildren.count( name ) || m_existingIndices.count( name ) )
     {
         ABCA_THROW( "Already have an Object named: "
                      << name );
@@ -161,7 +227,8 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
 
     Alembic::Util::shared_ptr<OwImpl> ret( new OwImpl( iParent,
                                            m_group->addGroup(),
-                                           header, m_childHeaders.size() ) );
+                                           header, m_childHeaders.size(),
+                                           Ogawa::IGroupPtr() ) );
 
     m_childHeaders.push_back( header );
     m_madeChildren[iHeader.getName()] = WeakOwPtr( ret );
@@ -176,6 +243,24 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
 void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
                            Util::SpookyHash & ioHash )
 {
+    // the existing children nobody asked for are referenced as is
+    for ( size_t i = 0; i < m_existingChildren.size(); ++i )
+    {
+        ExistingChild & child = m_existingChildren[i];
+        if ( !child.made )
+        {
+            CopyExistingGroup( child.group, child.existing );
+            HashExistingObject( child.existing, *m_childHeaders[i],
+                                m_existingArchive->getIndexedMetaData(),
+                                m_hashes[i * 2], m_hashes[i * 2 + 1] );
+            child.group.reset();
+            child.existing.reset();
+            child.made = true;
+        }
+    }
+
+    m_data->finishExistingProperties();
+
     std::vector< Util::uint8_t > data;
 
     // pack all object header into data here
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/MetaDataMap.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -55,6 +56,13 @@ class OwData : public Alembic::Util::enable_shared_from_this<OwData>
 public:
     OwData( Ogawa::OGroupPtr iGroup );
 
+    // for an object that was already written to the archive we are
+    // appending to
+    OwData( Ogawa::OGroupPtr iGroup,
+            Ogawa::IGroupPtr iExisting,
+            const std::string & iFullName,
+            ArImplPtr iExistingArchive );
+
     ~OwData();
 
     AbcA::CompoundPropertyWriterPtr getProperties(
@@ -67,7 +75,8 @@ public:
     const AbcA::ObjectHeader *
     getChildHeader( const std::string &iName );
 
-    AbcA::ObjectWriterPtr getChild( const std::string &iName );
+    AbcA::ObjectWriterPtr getChild( AbcA::ObjectWriterPtr iParent,
+                                    const std::string &iName );
 
     AbcA::ObjectWriterPtr createChild( AbcA::ObjectWriterPtr iParent,
                                        const std::string & iFullName,
@@ -99,6 +108,22 @@ private:
 
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
+
+    // The children which were already written to the archive we are
+    // appending to, they come first and are only rewritten if asked for.
+    struct ExistingChild
+    {
+        Ogawa::IGroupPtr existing;
+        Ogawa::OGroupPtr group;
+        bool made;
+    };
+
+    std::vector< ExistingChild > m_existingChildren;
+
+    // name to index of the existing children
+    std::map< std::string, size_t > m_existingIndices;
+
+    ArImplPtr m_existingArchive;
 };
 
 typedef Alembic::Util::shared_ptr<OwData> OwDataPtr;
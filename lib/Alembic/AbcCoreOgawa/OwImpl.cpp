@@ -58,7 +58,8 @@ OwImpl::OwImpl( AbcA::ArchiveWriterPtr iArchive,
 OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
                 Ogawa::OGroupPtr iGroup,
                 ObjectHeaderPtr iHeader,
-                size_t iIndex )
+                size_t iIndex,
+                Ogawa::IGroupPtr iExisting )
   : m_parent( iParent )
   , m_header( iHeader )
   , m_index( iIndex )
@@ -70,7 +71,18 @@ OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
     m_archive = m_parent->getArchive();
     ABCA_ASSERT( m_archive, "Invalid archive" );
 
-    m_data.reset( new OwData( iGroup ) );
+    if ( iExisting )
+    {
+        ArImplPtr existingArchive = Alembic::Util::dynamic_pointer_cast<
+            AwImpl, AbcA::ArchiveWriter >( m_archive )->getExistingArchive();
+
+        m_data.reset( new OwData( iGroup, iExisting, m_header->getFullName(),
+                                  existingArchive ) );
+    }
+    else
+    {
+        m_data.reset( new OwData( iGroup ) );
+    }
 }
 
 //-*****************************************************************************
@@ -150,7 +162,7 @@ const AbcA::ObjectHeader * OwImpl::getChildHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::ObjectWriterPtr OwImpl::getChild( const std::string &iName )
 {
-    return m_data->getChild( iName );
+    return m_data->getChild( asObjectPtr(), iName );
 }
 
 //-*****************************************************************************
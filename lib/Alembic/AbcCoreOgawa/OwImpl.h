@@ -56,10 +56,13 @@ public:
             OwDataPtr iData,
             const AbcA::MetaData & iMetaData );
 
+    // iExisting is only valid if this object was already written to the
+    // archive we are appending to
     OwImpl( AbcA::ObjectWriterPtr iParent,
             Ogawa::OGroupPtr iGroup,
             ObjectHeaderPtr iHeader,
-            size_t iIndex );
+            size_t iIndex,
+            Ogawa::IGroupPtr iExisting );
 
     virtual ~OwImpl();
 
@@ -51,12 +51,154 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+Util::uint64_t
+ReadNumBytes( Ogawa::IDataPtr iData,
+              size_t iThreadId,
+              bool iCompressed )
+{
+    Util::uint64_t dataSize = iData->getSize();
+
+    // empty, or just a key
+    if ( dataSize <= 16 )
+    {
+        return 0;
+    }
+
+    if ( !iCompressed )
+    {
+        return dataSize - 16;
+    }
+
+    ABCA_ASSERT( dataSize >= 24,
+        "Incorrect data, expected a key and the uncompressed size" );
+
+    Util::uint64_t numBytes = 0;
+    iData->read( 8, &numBytes, 16, iThreadId );
+    return numBytes;
+}
+
+//-*****************************************************************************
+// Reads iNumBytes of uncompressed sample data into oBuf
+static void
+ReadSampleBytes( Ogawa::IDataPtr iData,
+                 size_t iThreadId,
+                 bool iCompressed,
+                 std::size_t iNumBytes,
+                 void * oBuf )
+{
+    if ( iNumBytes == 0 )
+    {
+        return;
+    }
+
+    if ( !iCompressed )
+    {
+        iData->read( iNumBytes, oBuf, 16, iThreadId );
+        return;
+    }
+
+    // stored as is
+    std::size_t payloadSize = iData->getSize() - 24;
+    if ( payloadSize == iNumBytes )
+    {
+        iData->read( iNumBytes, oBuf, 24, iThreadId );
+        return;
+    }
+
+    // everything here is local so any number of threads can be doing this
+    // at the same time
+    std::vector< Util::uint8_t > payload( payloadSize );
+    iData->read( payloadSize, &payload.front(), 24, iThreadId );
+    Util::Decompress( &payload.front(), payloadSize, oBuf, iNumBytes );
+}
+
+//-*****************************************************************************
+Util::uint32_t
+ReadDeltaBase( Ogawa::IDataPtr iData,
+               size_t iThreadId )
+{
+    Util::uint32_t base = 0;
+    if ( iData->getSize() >= 28 )
+    {
+        iData->read( 4, &base, 24, iThreadId );
+    }
+    return base;
+}
+
+//-*****************************************************************************
+void
+ReadDeltaData( Ogawa::IDataPtr iData,
+               size_t iThreadId,
+               std::vector< Util::uint8_t > & ioBuf )
+{
+    // empty samples are never delta encoded
+    if ( iData->getSize() <= 16 )
+    {
+        ioBuf.clear();
+        return;
+    }
+
+    ABCA_ASSERT( iData->getSize() >= 28,
+        "Incorrect data, expected a key, the uncompressed size and a base" );
+
+    Util::uint64_t numBytes = 0;
+    iData->read( 8, &numBytes, 16, iThreadId );
+
+    Util::uint32_t base = 0;
+    iData->read( 4, &base, 24, iThreadId );
+
+    std::size_t payloadSize = iData->getSize() - 28;
+    std::vector< Util::uint8_t > payload( payloadSize );
+    if ( payloadSize > 0 )
+    {
+        iData->read( payloadSize, &payload.front(), 28, iThreadId );
+    }
+
+    if ( base == 0 )
+    {
+        ioBuf.resize( numBytes );
+        if ( numBytes == 0 )
+        {
+            return;
+        }
+
+        if ( payloadSize == numBytes )
+        {
+            ioBuf.swap( payload );
+        }
+        else
+        {
+            Util::Decompress( &payload.front(), payloadSize, &ioBuf.front(),
+                              numBytes );
+        }
+        return;
+    }
+
+    ABCA_ASSERT( ioBuf.size() == numBytes,
+        "Delta encoded sample doesn't match the size of its base sample" );
+
+    if ( payloadSize != numBytes )
+    {
+        std::vector< Util::uint8_t > delta( numBytes );
+        Util::Decompress( &payload.front(), payloadSize, &delta.front(),
+                          numBytes );
+        payload.swap( delta );
+    }
+
+    for ( std::size_t i = 0; i < numBytes; ++i )
+    {
+        ioBuf[i] ^= payload[i];
+    }
+}
+
 //-*****************************************************************************
 void
 ReadDimensions( Ogawa::IDataPtr iDims,
                 Ogawa::IDataPtr iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
+                bool iCompressed,
                 Util::Dimensions & oDim )
 {
     // find it based on of the size of the data
@@ -68,8 +210,9 @@ ReadDimensions( Ogawa::IDataPtr iDims,
         }
         else
         {
-            oDim = Util::Dimensions( ( iData->getSize() - 16 ) /
-                                     iDataType.getNumBytes() );
+            oDim = Util::Dimensions(
+                ReadNumBytes( iData, iThreadId, iCompressed ) /
+                iDataType.getNumBytes() );
         }
     }
     // we need to read our dimensions
@@ -1313,7 +1456,8 @@ ReadData( void * iIntoLocation,
           Ogawa::IDataPtr iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod )
+          Util::PlainOldDataType iAsPod,
+          bool iCompressed )
 {
     Alembic::Util::PlainOldDataType curPod = iDataType.getPod();
     ABCA_ASSERT( ( iAsPod == curPod ) || (
@@ -1397,13 +1541,16 @@ ReadData( void * iIntoLocation,
     else if ( iAsPod == curPod )
     {
         // don't read the key
-        iData->read( dataSize - 16, iIntoLocation, 16, iThreadId );
+        std::size_t numBytes = ReadNumBytes( iData, iThreadId, iCompressed );
+        ReadSampleBytes( iData, iThreadId, iCompressed, numBytes,
+                         iIntoLocation );
     }
     else if ( PODNumBytes( curPod ) <= PODNumBytes( iAsPod ) )
     {
-        // - 16 to skip key
-        std::size_t numBytes = dataSize - 16;
-        iData->read( numBytes, iIntoLocation, 16, iThreadId );
+        // skips the key
+        std::size_t numBytes = ReadNumBytes( iData, iThreadId, iCompressed );
+        ReadSampleBytes( iData, iThreadId, iCompressed, numBytes,
+                         iIntoLocation );
 
         char * buf = static_cast< char * >( iIntoLocation );
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
@@ -1411,12 +1558,12 @@ ReadData( void * iIntoLocation,
     }
     else if ( PODNumBytes( curPod ) > PODNumBytes( iAsPod ) )
     {
-        // - 16 to skip key
-        std::size_t numBytes = dataSize - 16;
+        // skips the key
+        std::size_t numBytes = ReadNumBytes( iData, iThreadId, iCompressed );
 
         // read into a temporary buffer and cast them one at a time
         char * buf = new char[ numBytes ];
-        iData->read( numBytes, buf, 16, iThreadId );
+        ReadSampleBytes( iData, iThreadId, iCompressed, numBytes, buf );
 
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
 
@@ -1431,16 +1578,17 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
+                 bool iCompressed,
                  AbcA::ArraySamplePtr &oSample )
 {
     // get our dimensions
     Util::Dimensions dims;
-    ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
+    ReadDimensions( iDims, iData, iThreadId, iDataType, iCompressed, dims );
 
     oSample = AbcA::AllocateArraySample( iDataType, dims );
 
     ReadData( const_cast<void*>( oSample->getData() ), iData,
-        iThreadId, iDataType, iDataType.getPod() );
+        iThreadId, iDataType, iDataType.getPod(), iCompressed );
 
 }
 
@@ -1631,6 +1779,15 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Whether the scalar samples are packed into one data block 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Whether the array samples may be compressed 0x20000000
+    // 0010 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Whether the array samples may be delta encoded 0x40000000
+    // 0100 0000 0000 0000 0000 0000 0000 0000
 
     Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
     ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
@@ -1698,6 +1855,12 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
 
             header->isHomogenous = ( info & 0x400 ) != 0;
 
+            header->isPacked = ( info & 0x10000000 ) != 0;
+
+            header->isCompressed = ( info & 0x20000000 ) != 0;
+
+            header->isDelta = ( info & 0x40000000 ) != 0;
+
             header->nextSampleIndex = GetUint32WithHint( buf, sizeHint, pos );
 
             if ( ( info & 0x0200 ) != 0 )
@@ -49,11 +49,14 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 
 //-*****************************************************************************
+// iCompressed is whether the data has the compressed sample layout
+// see PropertyHeaderAndFriends::isCompressed
 void
 ReadDimensions( Ogawa::IDataPtr iDims,
                 Ogawa::IDataPtr iData,
                 size_t iThreadId,
                 const AbcA::DataType &iDataType,
+                bool iCompressed,
                 Util::Dimensions & oDim );
 
 //-*****************************************************************************
@@ -62,7 +65,41 @@ ReadData( void * iIntoLocation,
           Ogawa::IDataPtr iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod );
+          Util::PlainOldDataType iAsPod,
+          bool iCompressed );
+
+//-*****************************************************************************
+// The number of bytes of sample data in iData once it is uncompressed
+Util::uint64_t
+ReadNumBytes( Ogawa::IDataPtr iData,
+              size_t iThreadId,
+              bool iCompressed );
+
+//-*****************************************************************************
+// Converts iSize bytes of fromPod data into toPod data, the buffers may be
+// the same if toPod is at least as big as fromPod
+void
+ConvertData( Alembic::Util::PlainOldDataType fromPod,
+             Alembic::Util::PlainOldDataType toPod,
+             char * fromBuffer,
+             void * toBuffer,
+             std::size_t iSize );
+
+//-*****************************************************************************
+// For delta encoded samples, see PropertyHeaderAndFriends::isDelta
+// Returns the storage index + 1 of the sample iData was encoded against,
+// or 0 if it is a key frame (or empty).
+Util::uint32_t
+ReadDeltaBase( Ogawa::IDataPtr iData,
+               size_t iThreadId );
+
+//-*****************************************************************************
+// Decodes the delta encoded sample in iData into ioBuf, unless iData is a
+// key frame ioBuf has to already hold the decoded sample it is based on.
+void
+ReadDeltaData( Ogawa::IDataPtr iData,
+               size_t iThreadId,
+               std::vector< Util::uint8_t > & ioBuf );
 
 //-*****************************************************************************
 void
@@ -70,6 +107,7 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
+                 bool iCompressed,
                  AbcA::ArraySamplePtr &oSample );
 
 //-*****************************************************************************
@@ -45,6 +45,21 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 WriteArchive::WriteArchive()
+    : m_packScalarSamples( false ), m_deltaKeyframeInterval( 0 )
+{
+}
+
+//-*****************************************************************************
+WriteArchive::WriteArchive( bool iPackScalarSamples )
+    : m_packScalarSamples( iPackScalarSamples ), m_deltaKeyframeInterval( 0 )
+{
+}
+
+//-*****************************************************************************
+WriteArchive::WriteArchive( bool iPackScalarSamples,
+                            Util::uint32_t iDeltaKeyframeInterval )
+    : m_packScalarSamples( iPackScalarSamples )
+    , m_deltaKeyframeInterval( iDeltaKeyframeInterval )
 {
 }
 
@@ -54,7 +69,8 @@ WriteArchive::operator()( const std::string &iFileName,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iFileName, iMetaData ) );
+        new AwImpl( iFileName, iMetaData, m_packScalarSamples,
+                    m_deltaKeyframeInterval ) );
     return archivePtr;
 }
 
@@ -64,25 +80,72 @@ WriteArchive::operator()( std::ostream * iStream,
                           const AbcA::MetaData &iMetaData ) const
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
-        new AwImpl( iStream, iMetaData ) );
+        new AwImpl( iStream, iMetaData, m_packScalarSamples,
+                    m_deltaKeyframeInterval ) );
+    return archivePtr;
+}
+
+//-*****************************************************************************
+AbcA::ArchiveWriterPtr
+WriteArchive::operator()( std::vector< char > * iBuffer,
+                          const AbcA::MetaData &iMetaData ) const
+{
+    Alembic::Util::shared_ptr<AwImpl> archivePtr(
+        new AwImpl( iBuffer, iMetaData, m_packScalarSamples,
+                    m_deltaKeyframeInterval ) );
+    return archivePtr;
+}
+
+//-*****************************************************************************
+AppendArchive::AppendArchive()
+    : m_packScalarSamples( false )
+{
+}
+
+//-*****************************************************************************
+AppendArchive::AppendArchive( bool iPackScalarSamples )
+    : m_packScalarSamples( iPackScalarSamples )
+{
+}
+
+//-*****************************************************************************
+AbcA::ArchiveWriterPtr
+AppendArchive::operator()( const std::string &iFileName,
+                           const AbcA::MetaData &iMetaData ) const
+{
+    // make sure we can read it before touching the file
+    ArImplPtr existing( new ArImpl( iFileName, 1 ) );
+
+    Alembic::Util::shared_ptr<AwImpl> archivePtr(
+        new AwImpl( iFileName, iMetaData, m_packScalarSamples, existing ) );
     return archivePtr;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive()
+    : m_buffer( NULL ), m_bufferSize( 0 ), m_retainedReaderCount( 0 )
 {
     m_numStreams = 1;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( size_t iNumStreams )
+    : m_buffer( NULL ), m_bufferSize( 0 ), m_retainedReaderCount( 0 )
 {
     m_numStreams = iNumStreams;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
-    : m_numStreams( 1 ), m_streams( iStreams )
+    : m_numStreams( 1 ), m_streams( iStreams ), m_buffer( NULL )
+    , m_bufferSize( 0 ), m_retainedReaderCount( 0 )
+{
+}
+
+//-*****************************************************************************
+ReadArchive::ReadArchive( const void * iBuffer, std::size_t iSize )
+    : m_numStreams( 1 ), m_buffer( iBuffer ), m_bufferSize( iSize )
+    , m_retainedReaderCount( 0 )
 {
 }
 
@@ -90,9 +153,14 @@ ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    Alembic::Util::shared_ptr<ArImpl> archivePtr;
 
-    if ( m_streams.empty() )
+    if ( m_buffer )
+    {
+        archivePtr = Alembic::Util::shared_ptr<ArImpl>(
+            new ArImpl( iFileName, m_buffer, m_bufferSize ) );
+    }
+    else if ( m_streams.empty() )
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
             new ArImpl( iFileName, m_numStreams ) );
@@ -102,6 +170,8 @@ ReadArchive::operator()( const std::string &iFileName ) const
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
             new ArImpl( m_streams ) );
     }
+
+    archivePtr->setRetainedReaderCount( m_retainedReaderCount );
     return archivePtr;
 }
 
@@ -111,18 +181,17 @@ AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    return ( *this )( iFileName );
+}
 
-    if ( m_streams.empty() )
-    {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( iFileName, m_numStreams ) );
-    }
-    else
-    {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( m_streams ) );
-    }
+//-*****************************************************************************
+AbcA::ArchiveReaderPtr
+ReadArchive::operator()( const std::string &iFileName,
+                         Util::int32_t iFileDescriptor ) const
+{
+    Alembic::Util::shared_ptr<ArImpl> archivePtr(
+        new ArImpl( iFileName, iFileDescriptor, m_numStreams ) );
+    archivePtr->setRetainedReaderCount( m_retainedReaderCount );
     return archivePtr;
 }
 
@@ -51,6 +51,22 @@ class ALEMBIC_EXPORT WriteArchive
 public:
     WriteArchive();
 
+    // If iPackScalarSamples is true, all of the samples of a scalar property
+    // (except string and wstring properties) will be written into one
+    // contiguous data block instead of one data block per sample.
+    // Archives written this way can not be read by older libraries.
+    explicit WriteArchive( bool iPackScalarSamples );
+
+    // If iDeltaKeyframeInterval is greater than 0 and a compression hint is
+    // set on the archive, the samples of float16, float32 and float64 array
+    // properties are stored as the difference to the previous sample (when
+    // it has the same size) before being compressed.  Every
+    // iDeltaKeyframeInterval'th written sample is stored whole, which bounds
+    // how many samples need to be read to get any one of them.
+    // Archives written this way can not be read by older libraries.
+    WriteArchive( bool iPackScalarSamples,
+                  ::Alembic::Util::uint32_t iDeltaKeyframeInterval );
+
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( const std::string &iFileName,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
@@ -58,6 +74,42 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( std::ostream * iStream,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+    // Write the archive into memory at the end of iBuffer, which we don't
+    // own.  iBuffer holds the complete archive once the writer is destroyed.
+    ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
+    operator()( std::vector< char > * iBuffer,
+                const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+private:
+    bool m_packScalarSamples;
+    ::Alembic::Util::uint32_t m_deltaKeyframeInterval;
+};
+
+//-*****************************************************************************
+//! Will return a shared pointer to an archive writer which appends to an
+//! existing, cleanly closed Ogawa archive.
+//! Existing objects and properties can be retrieved from the writer via
+//! getChild and getProperty, new samples are added after the ones which are
+//! already there and new objects and properties can be created.  Anything
+//! that isn't asked for is referenced as is instead of being rewritten.
+//! The file keeps reading as the original archive until the writer is
+//! destroyed, at which point the new top level group replaces it.
+class ALEMBIC_EXPORT AppendArchive
+{
+public:
+    AppendArchive();
+
+    // see WriteArchive, only new scalar properties are affected
+    explicit AppendArchive( bool iPackScalarSamples );
+
+    // iMetaData is added to the meta data already on the archive
+    ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
+    operator()( const std::string &iFileName,
+                const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+private:
+    bool m_packScalarSamples;
 };
 
 //-*****************************************************************************
@@ -76,6 +128,20 @@ public:
     // delete them
     ReadArchive( const std::vector< std::istream * > & iStreams );
 
+    // Read from an archive which is already in memory, the data is not
+    // copied and must remain valid and unchanged while the archive is read.
+    // The file name is only used as the name of the archive.
+    ReadArchive( const void * iBuffer, std::size_t iSize );
+
+    // Keep the parsed headers of the iCount most recently made object and
+    // compound property readers around after the readers themselves are
+    // released, so getting them again doesn't go back to the file.
+    // 0, the default, keeps none.
+    void setRetainedReaderCount( size_t iCount )
+    { m_retainedReaderCount = iCount; }
+
+    size_t getRetainedReaderCount() const { return m_retainedReaderCount; }
+
     // open the file
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
@@ -86,9 +152,20 @@ public:
                 ::Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCache
               ) const;
 
+    // Open iFileName which has already been opened for reading as
+    // iFileDescriptor, such as by something which looked at its first bytes
+    // to see what it is.  The archive takes ownership of iFileDescriptor and
+    // closes it, even if it isn't a valid Ogawa file.
+    ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
+    operator()( const std::string &iFileName,
+                ::Alembic::Util::int32_t iFileDescriptor ) const;
+
 private:
     size_t m_numStreams;
     std::vector< std::istream * > m_streams;
+    const void * m_buffer;
+    std::size_t m_bufferSize;
+    size_t m_retainedReaderCount;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
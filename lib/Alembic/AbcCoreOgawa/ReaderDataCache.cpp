@@ -0,0 +1,118 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/ReaderDataCache.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ReaderDataCache::ReaderDataCache()
+    : m_maxCount( 0 )
+{
+}
+
+//-*****************************************************************************
+ReaderDataCache::~ReaderDataCache()
+{
+}
+
+//-*****************************************************************************
+void ReaderDataCache::setMaxCount( std::size_t iMaxCount )
+{
+    // released outside of the lock
+    DataList released;
+
+    Alembic::Util::scoped_lock l( m_lock );
+    m_maxCount = iMaxCount;
+    while ( m_data.size() > m_maxCount )
+    {
+        m_dataMap.erase( m_data.back().get() );
+        released.splice( released.end(), m_data, --m_data.end() );
+    }
+}
+
+//-*****************************************************************************
+std::size_t ReaderDataCache::getMaxCount()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_maxCount;
+}
+
+//-*****************************************************************************
+std::size_t ReaderDataCache::getCount()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_data.size();
+}
+
+//-*****************************************************************************
+void ReaderDataCache::retain( Alembic::Util::shared_ptr< void > iData )
+{
+    if ( !iData )
+    {
+        return;
+    }
+
+    DataList released;
+
+    Alembic::Util::scoped_lock l( m_lock );
+    if ( m_maxCount == 0 )
+    {
+        return;
+    }
+
+    DataMap::iterator it = m_dataMap.find( iData.get() );
+    if ( it != m_dataMap.end() )
+    {
+        m_data.splice( m_data.begin(), m_data, it->second );
+        return;
+    }
+
+    m_data.push_front( iData );
+    m_dataMap[iData.get()] = m_data.begin();
+
+    if ( m_data.size() > m_maxCount )
+    {
+        m_dataMap.erase( m_data.back().get() );
+        released.splice( released.end(), m_data, --m_data.end() );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,91 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcCoreOgawa_ReaderDataCache_h_
+#define _Alembic_AbcCoreOgawa_ReaderDataCache_h_
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <list>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Object and compound property readers only keep their parsed headers (the
+// OrData and CprData) alive for as long as somebody holds on to them.  This
+// holds strong references to the data of the most recently made readers so
+// that dropping a reader and asking for it again doesn't have to go back to
+// the file.  The data doesn't refer back to the archive, so holding it here
+// can't keep the archive open.
+class ReaderDataCache : Alembic::Util::noncopyable
+{
+public:
+    ReaderDataCache();
+    ~ReaderDataCache();
+
+    // 0, the default, turns the cache off and releases everything held
+    void setMaxCount( std::size_t iMaxCount );
+    std::size_t getMaxCount();
+
+    std::size_t getCount();
+
+    // marks iData as the most recently used, releasing the least recently
+    // used data if there is now too much
+    void retain( Alembic::Util::shared_ptr< void > iData );
+
+private:
+    typedef std::list< Alembic::Util::shared_ptr< void > > DataList;
+    typedef std::map< void *, DataList::iterator > DataMap;
+
+    // most recently used at the front
+    DataList m_data;
+    DataMap m_dataMap;
+
+    std::size_t m_maxCount;
+    Alembic::Util::mutex m_lock;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
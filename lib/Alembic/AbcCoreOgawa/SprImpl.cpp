@@ -104,6 +104,39 @@ void SprImpl::getSample( index_t iSampleIndex, void * iIntoLocation )
 {
     size_t index = m_header->verifyIndex( iSampleIndex );
 
+    if ( m_header->isPacked )
+    {
+        const AbcA::DataType & dataType = m_header->header.getDataType();
+        size_t numBytes = dataType.getNumBytes();
+
+        Alembic::Util::scoped_lock l( m_packedLock );
+
+        if ( m_packedSamples.empty() )
+        {
+            StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast<
+                ArImpl, AbcA::ArchiveReader > (
+                    getObject()->getArchive() )->getStreamID();
+
+            std::size_t id = streamId->getID();
+            Ogawa::IDataPtr data = m_group->getData( 0, id );
+
+            ABCA_ASSERT( data && data->getSize() > 16,
+                "Invalid packed scalar data for: " <<
+                m_header->header.getName() );
+
+            m_packedSamples.resize( data->getSize() - 16 );
+            ReadData( &m_packedSamples.front(), data, id, dataType,
+                      dataType.getPod(), false );
+        }
+
+        ABCA_ASSERT( ( index + 1 ) * numBytes <= m_packedSamples.size(),
+            "Invalid packed scalar sample index: " << iSampleIndex );
+
+        memcpy( iIntoLocation, &m_packedSamples[ index * numBytes ],
+                numBytes );
+        return;
+    }
+
     StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
@@ -111,7 +144,7 @@ void SprImpl::getSample( index_t iSampleIndex, void * iIntoLocation )
     Ogawa::IDataPtr data = m_group->getData( index, id );
     ReadData( iIntoLocation, data, id,
               m_header->header.getDataType(),
-              m_header->header.getDataType().getPod() );
+              m_header->header.getDataType().getPod(), false );
 }
 
 //-*****************************************************************************
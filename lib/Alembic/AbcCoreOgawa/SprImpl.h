@@ -81,6 +81,10 @@ private:
     // Stores the PropertyHeader and other info
     PropertyHeaderPtr m_header;
 
+    // When the samples are packed they are all read in at once the first
+    // time any of them is asked for, and then served out of here.
+    std::vector< Util::uint8_t > m_packedSamples;
+    Alembic::Util::mutex m_packedLock;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/SpwImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
@@ -46,7 +47,8 @@ namespace ALEMBIC_VERSION_NS {
 SpwImpl::SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
                   Ogawa::OGroupPtr iGroup,
                   PropertyHeaderPtr iHeader,
-                  size_t iIndex ) :
+                  size_t iIndex,
+                  Ogawa::IGroupPtr iExisting ) :
     m_parent( iParent ), m_header( iHeader ), m_group( iGroup ),
     m_index( iIndex )
 {
@@ -59,6 +61,83 @@ SpwImpl::SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
         ABCA_THROW( "Attempted to create a ScalarPropertyWriter from a "
                     "non-scalar property type" );
     }
+
+    if ( iExisting )
+    {
+        initFromExisting( iExisting );
+        return;
+    }
+
+    Alembic::Util::PlainOldDataType pod =
+        m_header->header.getDataType().getPod();
+
+    AwImpl *archive = dynamic_cast< AwImpl * >(
+        m_parent->getObject()->getArchive().get() );
+
+    // strings and wstrings don't have a fixed size so they can't be packed
+    m_header->isPacked = archive && archive->getPackScalarSamples() &&
+        pod != Alembic::Util::kStringPOD && pod != Alembic::Util::kWstringPOD;
+}
+
+//-*****************************************************************************
+void SpwImpl::initFromExisting( Ogawa::IGroupPtr iExisting )
+{
+    // keep whatever packing the samples were already written with
+    if ( m_header->nextSampleIndex == 0 )
+    {
+        return;
+    }
+
+    m_hash = HashExistingSamples( iExisting, *m_header );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    size_t lastIndex = m_header->verifyIndex( m_header->nextSampleIndex - 1 );
+
+    if ( m_header->isPacked )
+    {
+        // the packed samples get written again as one block when we are done
+        Ogawa::IDataPtr data = iExisting->getData( 0, 0 );
+        ABCA_ASSERT( data && data->getSize() > 16,
+            "Invalid packed scalar data for: " << m_header->header.getName() );
+
+        m_packedSamples.resize( data->getSize() - 16 );
+        data->read( m_packedSamples.size(), &m_packedSamples.front(), 16, 0 );
+
+        size_t numBytes = dataType.getNumBytes();
+        ABCA_ASSERT( ( lastIndex + 1 ) * numBytes <= m_packedSamples.size(),
+            "Invalid packed scalar data for: " << m_header->header.getName() );
+
+        AbcA::ArraySample samp( &m_packedSamples[ lastIndex * numBytes ],
+                                dataType, AbcA::Dimensions( 1 ) );
+        AbcA::ArraySample::Key key = samp.getKey();
+        key.origPOD = Alembic::Util::kInt8POD;
+        key.readPOD = Alembic::Util::kInt8POD;
+
+        m_previousWrittenSampleID.reset(
+            new WrittenSampleID( key, Ogawa::ODataPtr(), 1 ) );
+        return;
+    }
+
+    // reference the samples that are already written
+    Ogawa::ODataPtr lastData;
+    Util::uint64_t numChildren = iExisting->getNumChildren();
+    for ( Util::uint64_t i = 0; i < numChildren; ++i )
+    {
+        Ogawa::ODataPtr data = m_group->addData( iExisting->getData( i, 0 ) );
+        if ( i == lastIndex )
+        {
+            lastData = data;
+        }
+    }
+
+    ABCA_ASSERT( lastData,
+        "Missing sample data for: " << m_header->header.getName() );
+
+    AbcA::ArraySample::Key key = ReadExistingKey(
+        iExisting->getData( lastIndex, 0 ), dataType, AbcA::Dimensions( 1 ) );
+
+    m_previousWrittenSampleID.reset(
+        new WrittenSampleID( key, lastData, dataType.getExtent() ) );
 }
 
 
@@ -70,6 +149,23 @@ SpwImpl::~SpwImpl()
     index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
             m_header->timeSamplingIndex );
 
+    // write all of the samples we've been holding onto at once
+    if ( m_header->isPacked && !m_packedSamples.empty() )
+    {
+        const AbcA::DataType & dataType = m_header->header.getDataType();
+        size_t numStored = m_packedSamples.size() / dataType.getNumBytes();
+
+        AbcA::ArraySample samp( &m_packedSamples.front(), dataType,
+                                AbcA::Dimensions( numStored ) );
+
+        // like in setSample, the POD doesn't matter when sharing the data
+        AbcA::ArraySample::Key key = samp.getKey();
+        key.origPOD = Alembic::Util::kInt8POD;
+        key.readPOD = Alembic::Util::kInt8POD;
+
+        WriteData( GetWrittenSampleMap( archive ), m_group, samp, key );
+    }
+
     Util::uint32_t numSamples = m_header->nextSampleIndex;
 
     // a constant property, we wrote the same sample over and over
@@ -159,26 +255,59 @@ void SpwImpl::setSample( const void *iSamp )
             key == m_previousWrittenSampleID->getKey() ) )
     {
 
-        // we only need to repeat samples if this is not the first change
-        if (m_header->firstChangedIndex != 0)
+        if ( m_header->isPacked )
         {
-            // copy the samples from after the last change to the latest index
-            for ( index_t smpI = m_header->lastChangedIndex + 1;
-                smpI < m_header->nextSampleIndex; ++smpI )
+            const Util::uint8_t * data =
+                static_cast< const Util::uint8_t * >( iSamp );
+            size_t numBytes = key.numBytes;
+
+            // we only need to repeat samples if this is not the first change
+            if (m_header->firstChangedIndex != 0)
             {
-                assert( smpI > 0 );
-                CopyWrittenData( m_group, m_previousWrittenSampleID );
+                // repeat the samples from after the last change to the
+                // latest index
+                std::vector< Util::uint8_t > prevSamp(
+                    m_packedSamples.end() - numBytes, m_packedSamples.end() );
+                for ( index_t smpI = m_header->lastChangedIndex + 1;
+                    smpI < m_header->nextSampleIndex; ++smpI )
+                {
+                    assert( smpI > 0 );
+                    m_packedSamples.insert( m_packedSamples.end(),
+                        prevSamp.begin(), prevSamp.end() );
+                }
             }
+
+            m_packedSamples.insert( m_packedSamples.end(), data,
+                                    data + numBytes );
+
+            // nothing is in the file yet, we just need to remember the key
+            m_previousWrittenSampleID.reset(
+                new WrittenSampleID( key, Ogawa::ODataPtr(), 1 ) );
         }
+        else
+        {
+            // we only need to repeat samples if this is not the first change
+            if (m_header->firstChangedIndex != 0)
+            {
+                // copy the samples from after the last change to the
+                // latest index
+                for ( index_t smpI = m_header->lastChangedIndex + 1;
+                    smpI < m_header->nextSampleIndex; ++smpI )
+                {
+                    assert( smpI > 0 );
+                    CopyWrittenData( m_group, m_previousWrittenSampleID );
+                }
+            }
 
-        // Write this sample, which will update its internal
-        // cache of what the previously written sample was.
-        AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
+            // Write this sample, which will update its internal
+            // cache of what the previously written sample was.
+            AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
 
-        // Write the sample.
-        // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, samp, key );
+            // Write the sample.
+            // This distinguishes between string, wstring, and regular arrays.
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, samp, key );
+        }
 
         if (m_header->firstChangedIndex == 0)
         {
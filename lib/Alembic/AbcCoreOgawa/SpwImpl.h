@@ -54,10 +54,13 @@ protected:
     friend class CpwData;
 
     //-*************************************************************************
+    // iExisting is only valid if this property was already written to the
+    // archive we are appending to, new samples are added after those
     SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
              Ogawa::OGroupPtr iGroup,
              PropertyHeaderPtr iHeader,
-             size_t iIndex );
+             size_t iIndex,
+             Ogawa::IGroupPtr iExisting );
 
     AbcA::ScalarPropertyWriterPtr asScalarPtr();
 
@@ -80,6 +83,8 @@ protected:
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
 private:
+    void initFromExisting( Ogawa::IGroupPtr iExisting );
+
     // The parent compound property writer.
     AbcA::CompoundPropertyWriterPtr m_parent;
 
@@ -93,6 +98,10 @@ private:
     Ogawa::OGroupPtr m_group;
 
     size_t m_index;
+
+    // When packing, the bytes of every stored sample, in order, which get
+    // written as a single data block when this property is done.
+    std::vector< Util::uint8_t > m_packedSamples;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
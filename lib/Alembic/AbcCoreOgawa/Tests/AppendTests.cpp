@@ -0,0 +1,376 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <iostream>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+//-*****************************************************************************
+// Writes the same scene in one go, or split across a write and an append.
+// iPass 0 writes everything, 1 only the first part and 2 appends the rest.
+void writeScene( const std::string & iName, int iPass, bool iPack,
+                 Alembic::Util::int8_t iCompressionHint )
+{
+    ABCA::ArchiveWriterPtr a;
+    if ( iPass == 2 )
+    {
+        ABCA::MetaData md;
+        md.set( "appended", "yes" );
+        a = AO::AppendArchive( iPack )( iName, md );
+    }
+    else
+    {
+        ABCA::MetaData md;
+        if ( iPass == 0 )
+        {
+            md.set( "appended", "yes" );
+        }
+        a = AO::WriteArchive( iPack )( iName, md );
+    }
+
+    a->setCompressionHint( iCompressionHint );
+
+    ABCA::ObjectWriterPtr top = a->getTop();
+    ABCA::DataType doubleType( Alembic::Util::kFloat64POD, 1 );
+    ABCA::DataType intType( Alembic::Util::kInt32POD, 1 );
+    ABCA::DataType strType( Alembic::Util::kStringPOD, 1 );
+
+    ABCA::MetaData objMeta;
+    objMeta.set( "schema", "potato" );
+
+    // the sampling is already there when appending
+    Alembic::Util::uint32_t tsIndex =
+        a->addTimeSampling( ABCA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+    TESTING_ASSERT( tsIndex == 1 );
+
+    ABCA::ObjectWriterPtr xform, child, untouched, deep;
+    ABCA::ScalarPropertyWriterPtr s, u, str;
+    ABCA::ArrayPropertyWriterPtr arr, leaf, strs;
+    ABCA::CompoundPropertyWriterPtr c, d;
+
+    if ( iPass != 2 )
+    {
+        xform = top->createChild( ABCA::ObjectHeader( "xform", objMeta ) );
+        s = xform->getProperties()->createScalarProperty( "s",
+            ABCA::MetaData(), doubleType, tsIndex );
+        u = xform->getProperties()->createScalarProperty( "u",
+            objMeta, doubleType, tsIndex );
+        str = xform->getProperties()->createScalarProperty( "str",
+            ABCA::MetaData(), strType, tsIndex );
+        arr = xform->getProperties()->createArrayProperty( "arr",
+            ABCA::MetaData(), intType, tsIndex );
+        strs = xform->getProperties()->createArrayProperty( "strs",
+            ABCA::MetaData(), strType, tsIndex );
+        c = xform->getProperties()->createCompoundProperty( "c", objMeta );
+        ABCA::ScalarPropertyWriterPtr cs = c->createScalarProperty( "cs",
+            ABCA::MetaData(), intType, 0 );
+        Alembic::Util::int32_t ci = 42;
+        cs->setSample( &ci );
+
+        d = xform->getProperties()->createCompoundProperty( "d",
+            ABCA::MetaData() );
+        leaf = d->createArrayProperty( "leaf", ABCA::MetaData(), doubleType,
+            tsIndex );
+
+        child = xform->createChild( ABCA::ObjectHeader( "child", objMeta ) );
+        child->getProperties()->createArrayProperty( "empty",
+            ABCA::MetaData(), intType, 0 );
+
+        untouched = top->createChild( ABCA::ObjectHeader( "untouched",
+            ABCA::MetaData() ) );
+        deep = untouched->createChild( ABCA::ObjectHeader( "deep",
+            objMeta ) );
+        ABCA::ArrayPropertyWriterPtr deepProp =
+            deep->getProperties()->createArrayProperty( "deepProp",
+                objMeta, doubleType, tsIndex );
+
+        std::vector< double > vals( 5, 2.0 );
+        for ( int i = 0; i < 3; ++i )
+        {
+            vals[i] = i;
+            deepProp->setSample( ABCA::ArraySample( &vals.front(),
+                doubleType, Alembic::Util::Dimensions( vals.size() ) ) );
+        }
+
+        double ud = 0.0;
+        for ( int i = 0; i < 3; ++i )
+        {
+            ud += 0.5;
+            u->setSample( &ud );
+        }
+    }
+    else
+    {
+        TESTING_ASSERT( top->getNumChildren() == 2 );
+        TESTING_ASSERT( !top->getChild( "nothere" ) );
+        xform = top->getChild( "xform" );
+        TESTING_ASSERT( xform && xform->getNumChildren() == 1 );
+        TESTING_ASSERT( xform->getHeader().getMetaData().get( "schema" ) ==
+                        "potato" );
+
+        // can't make it twice
+        TESTING_ASSERT_THROW( top->createChild( ABCA::ObjectHeader(
+            "untouched", ABCA::MetaData() ) ), Alembic::Util::Exception );
+
+        ABCA::CompoundPropertyWriterPtr props = xform->getProperties();
+        TESTING_ASSERT( props->getNumProperties() == 7 );
+        s = Alembic::Util::dynamic_pointer_cast< ABCA::ScalarPropertyWriter >(
+            props->getProperty( "s" ) );
+        str = Alembic::Util::dynamic_pointer_cast<
+            ABCA::ScalarPropertyWriter >( props->getProperty( "str" ) );
+        arr = Alembic::Util::dynamic_pointer_cast< ABCA::ArrayPropertyWriter >(
+            props->getProperty( "arr" ) );
+        strs = Alembic::Util::dynamic_pointer_cast<
+            ABCA::ArrayPropertyWriter >( props->getProperty( "strs" ) );
+        d = Alembic::Util::dynamic_pointer_cast<
+            ABCA::CompoundPropertyWriter >( props->getProperty( "d" ) );
+        leaf = Alembic::Util::dynamic_pointer_cast<
+            ABCA::ArrayPropertyWriter >( d->getProperty( "leaf" ) );
+        TESTING_ASSERT( s && str && arr && strs && d && leaf );
+        TESTING_ASSERT( s->getNumSamples() == 3 );
+        TESTING_ASSERT( arr->getNumSamples() == 3 );
+        TESTING_ASSERT( leaf->getNumSamples() == 3 );
+    }
+
+    // first pass writes samples 0 - 2, the append writes 3 - 5
+    int start = iPass == 2 ? 3 : 0;
+    int end = iPass == 1 ? 3 : 6;
+    for ( int i = start; i < end; ++i )
+    {
+        double sd = i * 1.5;
+        s->setSample( &sd );
+
+        // changes on sample 1 and on sample 4
+        std::string sv = i < 4 ? "hello" : "world";
+        if ( i == 1 )
+        {
+            sv = "there";
+        }
+        str->setSample( &sv );
+
+        std::vector< Alembic::Util::int32_t > ai( 3, 1 );
+        if ( i > 3 )
+        {
+            ai.resize( 2, 7 );
+        }
+        arr->setSample( ABCA::ArraySample( &ai.front(), intType,
+            Alembic::Util::Dimensions( ai.size() ) ) );
+
+        std::vector< std::string > sa( i % 2 + 1, "abc" );
+        strs->setSample( ABCA::ArraySample( &sa.front(), strType,
+            Alembic::Util::Dimensions( sa.size() ) ) );
+
+        // constant
+        std::vector< double > ld( 2, 3.0 );
+        leaf->setSample( ABCA::ArraySample( &ld.front(), doubleType,
+            Alembic::Util::Dimensions( ld.size() ) ) );
+    }
+
+    if ( iPass != 1 )
+    {
+        ABCA::ObjectWriterPtr added = xform->createChild(
+            ABCA::ObjectHeader( "added", objMeta ) );
+        ABCA::ScalarPropertyWriterPtr addedProp =
+            added->getProperties()->createScalarProperty( "addedProp",
+                objMeta, intType, 0 );
+        Alembic::Util::int32_t ai = 3;
+        addedProp->setSample( &ai );
+    }
+}
+
+//-*****************************************************************************
+void compareProperties( ABCA::CompoundPropertyReaderPtr iA,
+                        ABCA::CompoundPropertyReaderPtr iB )
+{
+    TESTING_ASSERT( iA->getNumProperties() == iB->getNumProperties() );
+    for ( size_t i = 0; i < iA->getNumProperties(); ++i )
+    {
+        const ABCA::PropertyHeader & ha = iA->getPropertyHeader( i );
+        const ABCA::PropertyHeader & hb = iB->getPropertyHeader( i );
+        TESTING_ASSERT( ha.getName() == hb.getName() );
+        TESTING_ASSERT( ha.getPropertyType() == hb.getPropertyType() );
+        TESTING_ASSERT( ha.getMetaData().serialize() ==
+                        hb.getMetaData().serialize() );
+
+        if ( ha.isCompound() )
+        {
+            compareProperties( iA->getCompoundProperty( i ),
+                               iB->getCompoundProperty( i ) );
+        }
+        else if ( ha.isArray() )
+        {
+            ABCA::ArrayPropertyReaderPtr a = iA->getArrayProperty( i );
+            ABCA::ArrayPropertyReaderPtr b = iB->getArrayProperty( i );
+            TESTING_ASSERT( a->getNumSamples() == b->getNumSamples() );
+            TESTING_ASSERT( a->isConstant() == b->isConstant() );
+            for ( size_t j = 0; j < a->getNumSamples(); ++j )
+            {
+                ABCA::ArraySampleKey ka, kb;
+                a->getKey( j, ka );
+                b->getKey( j, kb );
+                TESTING_ASSERT( ka == kb );
+
+                Alembic::Util::Dimensions da, db;
+                a->getDimensions( j, da );
+                b->getDimensions( j, db );
+                TESTING_ASSERT( da == db );
+            }
+        }
+        else
+        {
+            ABCA::ScalarPropertyReaderPtr a = iA->getScalarProperty( i );
+            ABCA::ScalarPropertyReaderPtr b = iB->getScalarProperty( i );
+            TESTING_ASSERT( a->getNumSamples() == b->getNumSamples() );
+            TESTING_ASSERT( a->isConstant() == b->isConstant() );
+            for ( size_t j = 0; j < a->getNumSamples(); ++j )
+            {
+                if ( ha.getDataType().getPod() == Alembic::Util::kStringPOD )
+                {
+                    std::string sa, sb;
+                    a->getSample( j, &sa );
+                    b->getSample( j, &sb );
+                    TESTING_ASSERT( sa == sb );
+                }
+                else
+                {
+                    char va[8] = {0};
+                    char vb[8] = {0};
+                    a->getSample( j, va );
+                    b->getSample( j, vb );
+                    TESTING_ASSERT( memcmp( va, vb, 8 ) == 0 );
+                }
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void compareObjects( ABCA::ObjectReaderPtr iA, ABCA::ObjectReaderPtr iB )
+{
+    TESTING_ASSERT( iA->getFullName() == iB->getFullName() );
+    TESTING_ASSERT( iA->getMetaData().serialize() ==
+                    iB->getMetaData().serialize() );
+
+    Alembic::Util::Digest da, db;
+    TESTING_ASSERT( iA->getPropertiesHash( da ) );
+    TESTING_ASSERT( iB->getPropertiesHash( db ) );
+    TESTING_ASSERT( da == db );
+
+    TESTING_ASSERT( iA->getChildrenHash( da ) );
+    TESTING_ASSERT( iB->getChildrenHash( db ) );
+    TESTING_ASSERT( da == db );
+
+    compareProperties( iA->getProperties(), iB->getProperties() );
+
+    TESTING_ASSERT( iA->getNumChildren() == iB->getNumChildren() );
+    for ( size_t i = 0; i < iA->getNumChildren(); ++i )
+    {
+        compareObjects( iA->getChild( i ), iB->getChild( i ) );
+    }
+}
+
+//-*****************************************************************************
+void testAppend( bool iPack, Alembic::Util::int8_t iCompressionHint )
+{
+    writeScene( "appendFull.abc", 0, iPack, iCompressionHint );
+    writeScene( "appendSplit.abc", 1, iPack, iCompressionHint );
+
+    {
+        // readers of the original are unaffected by the append
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr orig = r( "appendSplit.abc" );
+        TESTING_ASSERT( orig->getTop()->getChild( "xform" )->getNumChildren()
+                        == 1 );
+
+        writeScene( "appendSplit.abc", 2, iPack, iCompressionHint );
+
+        TESTING_ASSERT( orig->getTop()->getChild( "xform" )->getNumChildren()
+                        == 1 );
+        TESTING_ASSERT( orig->getMetaData().get( "appended" ) == "" );
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr full = r( "appendFull.abc" );
+    ABCA::ArchiveReaderPtr split = r( "appendSplit.abc" );
+
+    TESTING_ASSERT( split->getMetaData().get( "appended" ) == "yes" );
+    TESTING_ASSERT( full->getNumTimeSamplings() ==
+                    split->getNumTimeSamplings() );
+    for ( Alembic::Util::uint32_t i = 0; i < full->getNumTimeSamplings(); ++i )
+    {
+        TESTING_ASSERT( *full->getTimeSampling( i ) ==
+                        *split->getTimeSampling( i ) );
+        TESTING_ASSERT( full->getMaxNumSamplesForTimeSamplingIndex( i ) ==
+                        split->getMaxNumSamplesForTimeSamplingIndex( i ) );
+    }
+
+    compareObjects( full->getTop(), split->getTop() );
+
+    ABCA::ScalarPropertyReaderPtr s = split->getTop()->getChild( "xform" )->
+        getProperties()->getScalarProperty( "s" );
+    TESTING_ASSERT( s->getNumSamples() == 6 );
+    double sd = 0.0;
+    s->getSample( 5, &sd );
+    TESTING_ASSERT( sd == 7.5 );
+}
+
+//-*****************************************************************************
+void testAppendErrors()
+{
+    // nothing to append to
+    TESTING_ASSERT_THROW( AO::AppendArchive()( "appendMissing.abc",
+        ABCA::MetaData() ), Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testAppend( false, -1 );
+    testAppend( true, -1 );
+    testAppend( false, 5 );
+    testAppendErrors();
+    return 0;
+}
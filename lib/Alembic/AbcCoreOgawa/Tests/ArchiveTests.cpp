@@ -268,13 +268,18 @@ void testReadWriteMaxNumSamplesArchive()
     }
 }
 
-void writeArchive( const std::string & iName, std::ostream * iStream )
+void writeArchive( const std::string & iName, std::ostream * iStream,
+                   std::vector< char > * iBuffer = NULL )
 {
     ABCA::MetaData m;
     ABCA::ObjectHeader header("a", m);
     AO::WriteArchive w;
     ABCA::ArchiveWriterPtr a;
-    if (iStream)
+    if (iBuffer)
+    {
+        a = w(iBuffer, m);
+    }
+    else if (iStream)
     {
         a = w(iStream, m);
     }
@@ -327,7 +332,8 @@ void writeArchive( const std::string & iName, std::ostream * iStream )
     }
 }
 
-void readArchive( const std::string & iName, std::istream * iStream )
+void readArchive( const std::string & iName, std::istream * iStream,
+                  const std::vector< char > * iBuffer = NULL )
 {
     std::vector< std::istream * > streamVec;
     if (iStream)
@@ -335,6 +341,11 @@ void readArchive( const std::string & iName, std::istream * iStream )
         streamVec.push_back(iStream);
     }
     Alembic::AbcCoreOgawa::ReadArchive r(streamVec);
+    if (iBuffer)
+    {
+        r = Alembic::AbcCoreOgawa::ReadArchive(&(iBuffer->front()),
+                                               iBuffer->size());
+    }
     ABCA::ArchiveReaderPtr a = r( iName );
     std::vector< ABCA::ObjectReaderPtr > objs;
     objs.push_back( a->getTop() );
@@ -384,6 +395,23 @@ void readVeryEmptyArchive( const std::string & iName )
     TESTING_ASSERT(a->getTop()->getNumChildren() == 0);
 }
 
+void testMemoryArchive()
+{
+    std::vector< char > buffer;
+    writeArchive("", NULL, &buffer);
+    readArchive("memory", NULL, &buffer);
+
+    // byte for byte the same as the file that was written
+    std::ifstream strm("test.abc", std::ios_base::binary);
+    std::vector< char > fileBuffer((std::istreambuf_iterator< char >(strm)),
+                                   std::istreambuf_iterator< char >());
+    TESTING_ASSERT(buffer == fileBuffer);
+
+    // not even a whole header
+    AO::ReadArchive r(&(buffer.front()), 3);
+    TESTING_ASSERT_THROW(r("memory"), Alembic::Util::Exception);
+}
+
 void testGarbageArchive()
 {
     std::ofstream strm("garbage", std::ios_base::trunc | std::ios_base::binary);
@@ -407,6 +435,8 @@ int main ( int argc, char *argv[] )
     strStream.seekg(0, strStream.beg);
     readArchive("", &strStream);
 
+    testMemoryArchive();
+
     writeVeryEmptyArchive("testEmpty.abc");
     readVeryEmptyArchive("testEmpty.abc");
 
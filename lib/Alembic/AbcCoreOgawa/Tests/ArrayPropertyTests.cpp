@@ -36,10 +36,12 @@
 
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Ogawa/All.h>
 #include <Alembic/Util/All.h>
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -1966,6 +1968,397 @@ void testWriteWhileRead()
     }
 }
 
+//-*****************************************************************************
+void writeCompressionArchive( const std::string & iName, int8_t iHint )
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w( iName, ABCA::MetaData() );
+    a->setCompressionHint( iHint );
+
+    ABCA::ObjectWriterPtr obj = a->getTop()->createChild(
+        ABCA::ObjectHeader( "obj", ABCA::MetaData() ) );
+    ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+
+    ABCA::DataType v3fType( kFloat32POD, 3 );
+    ABCA::ArrayPropertyWriterPtr pw = props->createArrayProperty( "P",
+        ABCA::MetaData(), v3fType, 0 );
+
+    std::vector< float32_t > points;
+    for ( size_t i = 0; i < 3000; ++i )
+    {
+        points.push_back( ( float32_t ) ( i % 30 ) * 0.5f );
+        points.push_back( ( float32_t ) ( i / 30 ) * 0.5f );
+        points.push_back( 1.0f );
+    }
+    ABCA::ArraySample pointSamp( &points.front(), v3fType,
+                                 Dimensions( 3000 ) );
+    pw->setSample( pointSamp );
+    pw->setSample( pointSamp );
+    points[5] = 17.0f;
+    pw->setSample( ABCA::ArraySample( &points.front(), v3fType,
+                                      Dimensions( 3000 ) ) );
+
+    // the same sample on another property shares the data
+    ABCA::ArrayPropertyWriterPtr p2w = props->createArrayProperty( "P2",
+        ABCA::MetaData(), v3fType, 0 );
+    p2w->setSample( pointSamp );
+
+    ABCA::DataType i32Type( kInt32POD, 1 );
+    std::vector< int32_t > indices;
+    for ( size_t i = 0; i < 8000; ++i )
+    {
+        indices.push_back( i % 4 + ( i / 4 ) * 2 );
+    }
+    props->createArrayProperty( "idx", ABCA::MetaData(), i32Type, 0 )->
+        setSample( ABCA::ArraySample( &indices.front(), i32Type,
+                                      Dimensions( indices.size() ) ) );
+
+    // too small to compress
+    ABCA::DataType f64Type( kFloat64POD, 1 );
+    float64_t smallVals[4] = { 1.0, 2.0, 3.0, 4.0 };
+    props->createArrayProperty( "small", ABCA::MetaData(), f64Type, 0 )->
+        setSample( ABCA::ArraySample( smallVals, f64Type, Dimensions( 4 ) ) );
+
+    // won't compress
+    ABCA::DataType u8Type( kUint8POD, 1 );
+    std::vector< uint8_t > noise( 2000 );
+    uint32_t seed = 42;
+    for ( size_t i = 0; i < noise.size(); ++i )
+    {
+        seed = seed * 1103515245 + 12345;
+        noise[i] = ( uint8_t ) ( seed >> 16 );
+    }
+    props->createArrayProperty( "noise", ABCA::MetaData(), u8Type, 0 )->
+        setSample( ABCA::ArraySample( &noise.front(), u8Type,
+                                      Dimensions( noise.size() ) ) );
+
+    // rank 2
+    std::vector< float32_t > grid( 200, 3.0f );
+    Dimensions gridDims;
+    gridDims.setRank( 2 );
+    gridDims[0] = 10;
+    gridDims[1] = 20;
+    ABCA::DataType f32Type( kFloat32POD, 1 );
+    props->createArrayProperty( "grid", ABCA::MetaData(), f32Type, 0 )->
+        setSample( ABCA::ArraySample( &grid.front(), f32Type, gridDims ) );
+
+    ABCA::ArrayPropertyWriterPtr ew = props->createArrayProperty( "empty",
+        ABCA::MetaData(), i32Type, 0 );
+    ew->setSample( ABCA::ArraySample( NULL, i32Type, Dimensions( 0 ) ) );
+    ew->setSample( ABCA::ArraySample( &indices.front(), i32Type,
+                                      Dimensions( 1000 ) ) );
+
+    ABCA::DataType strType( kStringPOD, 1 );
+    std::vector< std::string > strs( 100, "potato" );
+    props->createArrayProperty( "str", ABCA::MetaData(), strType, 0 )->
+        setSample( ABCA::ArraySample( &strs.front(), strType,
+                                      Dimensions( strs.size() ) ) );
+
+    // a scalar with the same key as a one element array can't share data
+    // with it because the array data has a different layout
+    props->createArrayProperty( "one", ABCA::MetaData(), i32Type, 0 )->
+        setSample( ABCA::ArraySample( &indices[5], i32Type, Dimensions( 1 ) ) );
+    props->createScalarProperty( "scalar", ABCA::MetaData(), i32Type, 0 )->
+        setSample( &indices[5] );
+}
+
+//-*****************************************************************************
+void testCompressedArrays()
+{
+    writeCompressionArchive( "uncompressedArrays.abc", -1 );
+    writeCompressionArchive( "compressedArrays.abc", 9 );
+
+    {
+        Alembic::Ogawa::IArchive plain( "uncompressedArrays.abc" );
+        Alembic::Ogawa::IArchive compressed( "compressedArrays.abc" );
+        int32_t plainVersion = -1;
+        int32_t compressedVersion = -1;
+        plain.getGroup()->getData( 0, 0 )->read( 4, &plainVersion, 0, 0 );
+        compressed.getGroup()->getData( 0, 0 )->read( 4, &compressedVersion,
+                                                      0, 0 );
+        TESTING_ASSERT( plainVersion == 0 );
+        TESTING_ASSERT( compressedVersion == 2 );
+
+        std::ifstream plainFile( "uncompressedArrays.abc",
+            std::ios_base::binary | std::ios_base::ate );
+        std::ifstream compressedFile( "compressedArrays.abc",
+            std::ios_base::binary | std::ios_base::ate );
+        TESTING_ASSERT( compressedFile.tellg() * 2 < plainFile.tellg() );
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr plainArchive = r( "uncompressedArrays.abc" );
+    ABCA::ArchiveReaderPtr compArchive = r( "compressedArrays.abc" );
+
+    ABCA::ObjectReaderPtr plainObj = plainArchive->getTop()->getChild( 0 );
+    ABCA::ObjectReaderPtr compObj = compArchive->getTop()->getChild( 0 );
+
+    Digest plainHash, compHash;
+    TESTING_ASSERT( plainObj->getPropertiesHash( plainHash ) );
+    TESTING_ASSERT( compObj->getPropertiesHash( compHash ) );
+    TESTING_ASSERT( plainHash == compHash );
+
+    ABCA::CompoundPropertyReaderPtr plainProps = plainObj->getProperties();
+    ABCA::CompoundPropertyReaderPtr compProps = compObj->getProperties();
+    TESTING_ASSERT( plainProps->getNumProperties() ==
+                    compProps->getNumProperties() );
+
+    for ( size_t i = 0; i < compProps->getNumProperties(); ++i )
+    {
+        const ABCA::PropertyHeader & header = compProps->getPropertyHeader( i );
+        if ( !header.isArray() )
+        {
+            int32_t plainVal = 0;
+            int32_t compVal = 1;
+            plainProps->getScalarProperty( header.getName() )->getSample(
+                0, &plainVal );
+            compProps->getScalarProperty( header.getName() )->getSample(
+                0, &compVal );
+            TESTING_ASSERT( plainVal == compVal );
+            continue;
+        }
+
+        ABCA::ArrayPropertyReaderPtr plainProp =
+            plainProps->getArrayProperty( header.getName() );
+        ABCA::ArrayPropertyReaderPtr compProp =
+            compProps->getArrayProperty( header.getName() );
+        TESTING_ASSERT( plainProp->getNumSamples() ==
+                        compProp->getNumSamples() );
+
+        for ( size_t j = 0; j < compProp->getNumSamples(); ++j )
+        {
+            ABCA::ArraySamplePtr plainSamp, compSamp;
+            plainProp->getSample( j, plainSamp );
+            compProp->getSample( j, compSamp );
+            TESTING_ASSERT( plainSamp->getDimensions() ==
+                            compSamp->getDimensions() );
+            TESTING_ASSERT( plainSamp->getKey() == compSamp->getKey() );
+
+            ABCA::ArraySampleKey plainKey, compKey;
+            TESTING_ASSERT( plainProp->getKey( j, plainKey ) );
+            TESTING_ASSERT( compProp->getKey( j, compKey ) );
+            TESTING_ASSERT( plainKey == compKey );
+
+            Dimensions dims;
+            compProp->getDimensions( j, dims );
+            TESTING_ASSERT( dims == compSamp->getDimensions() );
+        }
+    }
+
+    // converting compressed data
+    ABCA::ArrayPropertyReaderPtr pr = compProps->getArrayProperty( "P" );
+    std::vector< float64_t > asDouble( 9000 );
+    pr->getAs( 2, &asDouble.front(), kFloat64POD );
+    TESTING_ASSERT( asDouble[5] == 17.0 && asDouble[3] == 0.5 );
+    std::vector< float16_t > asHalf( 9000 );
+    pr->getAs( 0, &asHalf.front(), kFloat16POD );
+    TESTING_ASSERT( asHalf[5] == 1.0f && asHalf[4] == 0.0f );
+
+    ABCA::ArraySamplePtr samp;
+    pr->getSample( 2, samp );
+    TESTING_ASSERT( static_cast< const float32_t * >(
+        samp->getData() )[5] == 17.0f );
+}
+
+//-*****************************************************************************
+void writeDeltaArchive( const std::string & iName, uint32_t iInterval,
+                        int8_t iHint )
+{
+    AO::WriteArchive w( false, iInterval );
+    ABCA::ArchiveWriterPtr a = w( iName, ABCA::MetaData() );
+    a->setCompressionHint( iHint );
+
+    ABCA::ObjectWriterPtr obj = a->getTop()->createChild(
+        ABCA::ObjectHeader( "obj", ABCA::MetaData() ) );
+    ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+
+    ABCA::DataType v3fType( kFloat32POD, 3 );
+    ABCA::ArrayPropertyWriterPtr pw = props->createArrayProperty( "P",
+        ABCA::MetaData(), v3fType, 0 );
+
+    ABCA::DataType i32Type( kInt32POD, 1 );
+    ABCA::ArrayPropertyWriterPtr iw = props->createArrayProperty( "idx",
+        ABCA::MetaData(), i32Type, 0 );
+
+    ABCA::DataType f64Type( kFloat64POD, 1 );
+    ABCA::ArrayPropertyWriterPtr sw = props->createArrayProperty( "small",
+        ABCA::MetaData(), f64Type, 0 );
+
+    // scattered points don't compress well on their own
+    std::vector< float32_t > points;
+    std::vector< int32_t > indices;
+    uint32_t seed = 7;
+    for ( size_t i = 0; i < 6000; ++i )
+    {
+        seed = seed * 1103515245 + 12345;
+        points.push_back( ( float32_t ) ( seed >> 8 ) / 65536.0f );
+    }
+
+    for ( size_t i = 0; i < 2000; ++i )
+    {
+        indices.push_back( i % 4 + ( i / 4 ) * 2 );
+    }
+
+    for ( size_t frame = 0; frame < 40; ++frame )
+    {
+        // only a few points move each frame
+        for ( size_t i = 0; i < 50; ++i )
+        {
+            points[ ( ( frame * 50 + i ) * 3 + 2 ) % points.size() ] +=
+                0.125f;
+        }
+
+        size_t numPoints = points.size() / 3;
+
+        // change the size for a few frames
+        if ( frame >= 20 && frame < 23 )
+        {
+            numPoints -= 100;
+        }
+
+        // repeat a sample, and have an empty one
+        if ( frame == 10 )
+        {
+            pw->setFromPreviousSample();
+        }
+        else if ( frame == 30 )
+        {
+            pw->setSample( ABCA::ArraySample( NULL, v3fType,
+                                              Dimensions( 0 ) ) );
+        }
+        else
+        {
+            pw->setSample( ABCA::ArraySample( &points.front(), v3fType,
+                                              Dimensions( numPoints ) ) );
+        }
+
+        indices[frame] = frame;
+        iw->setSample( ABCA::ArraySample( &indices.front(), i32Type,
+                                          Dimensions( indices.size() ) ) );
+
+        float64_t smallVals[2] = { 1.0, ( float64_t ) frame };
+        sw->setSample( ABCA::ArraySample( smallVals, f64Type,
+                                          Dimensions( 2 ) ) );
+    }
+
+    // a constant property has nothing to delta against
+    ABCA::ArrayPropertyWriterPtr cw = props->createArrayProperty( "const",
+        ABCA::MetaData(), v3fType, 0 );
+    for ( size_t frame = 0; frame < 5; ++frame )
+    {
+        cw->setSample( ABCA::ArraySample( &points.front(), v3fType,
+                                          Dimensions( 2000 ) ) );
+    }
+}
+
+//-*****************************************************************************
+void compareDeltaSample( ABCA::ArrayPropertyReaderPtr iPlainProp,
+                         ABCA::ArrayPropertyReaderPtr iDeltaProp,
+                         size_t iIndex )
+{
+    ABCA::ArraySamplePtr plainSamp, deltaSamp;
+    iPlainProp->getSample( iIndex, plainSamp );
+    iDeltaProp->getSample( iIndex, deltaSamp );
+    TESTING_ASSERT( plainSamp->getDimensions() ==
+                    deltaSamp->getDimensions() );
+    TESTING_ASSERT( plainSamp->getKey() == deltaSamp->getKey() );
+
+    ABCA::ArraySampleKey plainKey, deltaKey;
+    TESTING_ASSERT( iPlainProp->getKey( iIndex, plainKey ) );
+    TESTING_ASSERT( iDeltaProp->getKey( iIndex, deltaKey ) );
+    TESTING_ASSERT( plainKey == deltaKey );
+
+    Dimensions dims;
+    iDeltaProp->getDimensions( iIndex, dims );
+    TESTING_ASSERT( dims == deltaSamp->getDimensions() );
+}
+
+//-*****************************************************************************
+void testDeltaArrays()
+{
+    writeDeltaArchive( "plainDelta.abc", 0, -1 );
+    writeDeltaArchive( "compressedNoDelta.abc", 0, 9 );
+    writeDeltaArchive( "delta.abc", 8, 9 );
+
+    // without a compression hint the interval is ignored
+    writeDeltaArchive( "deltaNoHint.abc", 8, -1 );
+
+    {
+        Alembic::Ogawa::IArchive deltaOgawa( "delta.abc" );
+        Alembic::Ogawa::IArchive noHintOgawa( "deltaNoHint.abc" );
+        int32_t deltaVersion = -1;
+        int32_t noHintVersion = -1;
+        deltaOgawa.getGroup()->getData( 0, 0 )->read( 4, &deltaVersion, 0, 0 );
+        noHintOgawa.getGroup()->getData( 0, 0 )->read( 4, &noHintVersion,
+                                                       0, 0 );
+        TESTING_ASSERT( deltaVersion == 3 );
+        TESTING_ASSERT( noHintVersion == 0 );
+
+        std::ifstream compressedFile( "compressedNoDelta.abc",
+            std::ios_base::binary | std::ios_base::ate );
+        std::ifstream deltaFile( "delta.abc",
+            std::ios_base::binary | std::ios_base::ate );
+        TESTING_ASSERT( deltaFile.tellg() * 2 < compressedFile.tellg() );
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr plainArchive = r( "plainDelta.abc" );
+    ABCA::ArchiveReaderPtr deltaArchive = r( "delta.abc" );
+
+    ABCA::ObjectReaderPtr plainObj = plainArchive->getTop()->getChild( 0 );
+    ABCA::ObjectReaderPtr deltaObj = deltaArchive->getTop()->getChild( 0 );
+
+    Digest plainHash, deltaHash;
+    TESTING_ASSERT( plainObj->getPropertiesHash( plainHash ) );
+    TESTING_ASSERT( deltaObj->getPropertiesHash( deltaHash ) );
+    TESTING_ASSERT( plainHash == deltaHash );
+
+    ABCA::CompoundPropertyReaderPtr plainProps = plainObj->getProperties();
+    ABCA::CompoundPropertyReaderPtr deltaProps = deltaObj->getProperties();
+
+    for ( size_t i = 0; i < deltaProps->getNumProperties(); ++i )
+    {
+        const std::string & name = deltaProps->getPropertyHeader( i ).getName();
+        ABCA::ArrayPropertyReaderPtr plainProp =
+            plainProps->getArrayProperty( name );
+        ABCA::ArrayPropertyReaderPtr deltaProp =
+            deltaProps->getArrayProperty( name );
+        size_t numSamples = deltaProp->getNumSamples();
+        TESTING_ASSERT( plainProp->getNumSamples() == numSamples );
+
+        // in order, backwards, and jumping around
+        for ( size_t j = 0; j < numSamples; ++j )
+        {
+            compareDeltaSample( plainProp, deltaProp, j );
+        }
+
+        for ( size_t j = numSamples; j > 0; --j )
+        {
+            compareDeltaSample( plainProp, deltaProp, j - 1 );
+        }
+
+        for ( size_t j = 0; j < numSamples; ++j )
+        {
+            compareDeltaSample( plainProp, deltaProp, ( j * 7 ) % numSamples );
+        }
+    }
+
+    // converting delta encoded data
+    ABCA::ArrayPropertyReaderPtr plainP = plainProps->getArrayProperty( "P" );
+    ABCA::ArrayPropertyReaderPtr deltaP = deltaProps->getArrayProperty( "P" );
+    std::vector< float64_t > plainDouble( 6000 );
+    std::vector< float64_t > deltaDouble( 6000 );
+    plainP->getAs( 37, &plainDouble.front(), kFloat64POD );
+    deltaP->getAs( 37, &deltaDouble.front(), kFloat64POD );
+    TESTING_ASSERT( plainDouble == deltaDouble );
+
+    std::vector< float32_t > plainFloat( 6000 );
+    std::vector< float32_t > deltaFloat( 6000 );
+    plainP->getAs( 15, &plainFloat.front(), kFloat32POD );
+    deltaP->getAs( 15, &deltaFloat.front(), kFloat32POD );
+    TESTING_ASSERT( plainFloat == deltaFloat );
+}
+
 int main ( int argc, char *argv[] )
 {
     testEmptyArray();
@@ -1975,5 +2368,7 @@ int main ( int argc, char *argv[] )
     testArrayStringsRepeats();
     testArraySamples();
     testWriteWhileRead();
+    testCompressedArrays();
+    testDeltaArrays();
     return 0;
 }
@@ -35,6 +35,8 @@
 //-*****************************************************************************
 
 #include <sstream>
+#include <fstream>
+#include <iterator>
 #include <Alembic/AbcCoreAbstract/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/Util/All.h>
@@ -301,10 +303,173 @@ void testMetaData()
     }
 }
 
+//-*****************************************************************************
+void testSharedMetaData()
+{
+    std::string archiveName = "objectSharedMetaDataTest.abc";
+    {
+        AO::WriteArchive w;
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::ObjectWriterPtr archive = a->getTop();
+
+        AbcA::MetaData m;
+        m.set("schema", "Test_v1");
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            std::stringstream strm;
+            strm << i;
+            AbcA::ObjectWriterPtr child = archive->createChild(
+                AbcA::ObjectHeader(strm.str(), m));
+            child->getProperties()->createCompoundProperty("a", m);
+            child->getProperties()->createCompoundProperty("b", m);
+        }
+    }
+
+    {
+        AO::ReadArchive r;
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+        AbcA::ObjectReaderPtr archive = a->getTop();
+
+        // everything with the same indexed metadata shares one dictionary
+        const AbcA::MetaData & first = archive->getChildHeader(0).getMetaData();
+        TESTING_ASSERT(first.get("schema") == "Test_v1");
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            AbcA::ObjectReaderPtr child = archive->getChild(i);
+            TESTING_ASSERT(&*child->getMetaData().begin() == &*first.begin());
+
+            AbcA::CompoundPropertyReaderPtr props = child->getProperties();
+            TESTING_ASSERT(props->getNumProperties() == 2);
+            for (std::size_t j = 0; j < 2; ++j)
+            {
+                const AbcA::MetaData & md =
+                    props->getPropertyHeader(j).getMetaData();
+                TESTING_ASSERT(&*md.begin() == &*first.begin());
+            }
+        }
+
+        // and changing a copy leaves the shared one alone
+        AbcA::MetaData copy = first;
+        copy.set("schema", "Other_v1");
+        TESTING_ASSERT(first.get("schema") == "Test_v1");
+        TESTING_ASSERT(archive->getChild(5)->getMetaData().get("schema") ==
+                       "Test_v1");
+    }
+}
+
+//-*****************************************************************************
+// counts how many times the file data gets read
+class CountingBuf : public std::stringbuf
+{
+public:
+    CountingBuf( const std::string & iData )
+        : std::stringbuf( iData, std::ios_base::in ), numReads( 0 ) {}
+
+    std::size_t numReads;
+
+protected:
+    virtual std::streamsize xsgetn( char * oBuf, std::streamsize iSize )
+    {
+        ++numReads;
+        return std::stringbuf::xsgetn( oBuf, iSize );
+    }
+};
+
+//-*****************************************************************************
+// walks down to the inner compound property of /a/b/c and lets go of it all
+void walkRetained( AbcA::ArchiveReaderPtr iArchive )
+{
+    AbcA::ObjectReaderPtr obj = iArchive->getTop();
+    obj = obj->getChild( "a" )->getChild( "b" )->getChild( "c" );
+    TESTING_ASSERT( obj && obj->getFullName() == "/a/b/c" );
+
+    AbcA::CompoundPropertyReaderPtr inner =
+        obj->getProperties()->getCompoundProperty( "outer" )->
+            getCompoundProperty( "inner" );
+    TESTING_ASSERT( inner && inner->getNumProperties() == 1 );
+    TESTING_ASSERT( inner->getPropertyHeader( 0 ).getName() == "leaf" );
+}
+
+//-*****************************************************************************
+void testRetainedReaders()
+{
+    std::string archiveName = "retainedReaderTest.abc";
+    {
+        AO::WriteArchive w;
+        AbcA::ArchiveWriterPtr a = w(archiveName, AbcA::MetaData());
+        AbcA::ObjectWriterPtr obj = a->getTop();
+        obj = obj->createChild( AbcA::ObjectHeader( "a", AbcA::MetaData() ) );
+        obj = obj->createChild( AbcA::ObjectHeader( "b", AbcA::MetaData() ) );
+        obj = obj->createChild( AbcA::ObjectHeader( "c", AbcA::MetaData() ) );
+        AbcA::CompoundPropertyWriterPtr outer =
+            obj->getProperties()->createCompoundProperty( "outer",
+                AbcA::MetaData() );
+        AbcA::CompoundPropertyWriterPtr inner =
+            outer->createCompoundProperty( "inner", AbcA::MetaData() );
+        inner->createScalarProperty( "leaf", AbcA::MetaData(),
+            AbcA::DataType( Alembic::Util::kInt32POD, 1 ), 0 );
+    }
+
+    std::ifstream fileStrm( archiveName.c_str(), std::ios::binary );
+    std::string fileData( ( std::istreambuf_iterator< char >( fileStrm ) ),
+                          std::istreambuf_iterator< char >() );
+
+    // nothing is retained by default, everything gets read again
+    {
+        CountingBuf buf( fileData );
+        std::istream strm( &buf );
+        std::vector< std::istream * > streams( 1, &strm );
+        AO::ReadArchive r( streams );
+        TESTING_ASSERT( r.getRetainedReaderCount() == 0 );
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+
+        walkRetained( a );
+        std::size_t numReads = buf.numReads;
+        walkRetained( a );
+        TESTING_ASSERT( buf.numReads > numReads );
+    }
+
+    // the data of all 5 readers that get made is kept
+    {
+        CountingBuf buf( fileData );
+        std::istream strm( &buf );
+        std::vector< std::istream * > streams( 1, &strm );
+        AO::ReadArchive r( streams );
+        r.setRetainedReaderCount( 5 );
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+
+        walkRetained( a );
+        std::size_t numReads = buf.numReads;
+        for ( std::size_t i = 0; i < 3; ++i )
+        {
+            walkRetained( a );
+            TESTING_ASSERT( buf.numReads == numReads );
+        }
+    }
+
+    // not enough room for all of them, some get read again
+    {
+        CountingBuf buf( fileData );
+        std::istream strm( &buf );
+        std::vector< std::istream * > streams( 1, &strm );
+        AO::ReadArchive r( streams );
+        r.setRetainedReaderCount( 2 );
+        AbcA::ArchiveReaderPtr a = r( archiveName );
+
+        walkRetained( a );
+        std::size_t numReads = buf.numReads;
+        walkRetained( a );
+        TESTING_ASSERT( buf.numReads > numReads );
+    }
+}
+
+//-*****************************************************************************
 int main ( int argc, char *argv[] )
 {
     testObjects();
     testChildObjects();
     testMetaData();
+    testSharedMetaData();
+    testRetainedReaders();
     return 0;
 }
@@ -837,6 +837,146 @@ void testScalarSamples()
     }
 }
 
+//-*****************************************************************************
+void writePackedScalarData( const std::string & iArchiveName, bool iPack )
+{
+    AO::WriteArchive w( iPack );
+    AbcA::ArchiveWriterPtr a = w(iArchiveName, AbcA::MetaData());
+    AbcA::ObjectWriterPtr archive = a->getTop();
+
+    AbcA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+    AbcA::ScalarPropertyWriterPtr swp =
+        parent->createScalarProperty("int32", AbcA::MetaData(),
+            AbcA::DataType(Alembic::Util::kInt32POD, 3), 0);
+
+    std::vector <Alembic::Util::int32_t> ui(3);
+    ui[0] = 0;
+    ui[1] = 1;
+    ui[2] = 2;
+
+    std::vector <Alembic::Util::int32_t> ui2(3);
+    ui2[0] = 41;
+    ui2[1] = 43;
+    ui2[2] = 47;
+
+    swp->setSample(&(ui.front()));
+    swp->setSample(&(ui.front()));
+    swp->setSample(&(ui2.front()));
+    swp->setSample(&(ui.front()));
+    swp->setSample(&(ui2.front()));
+    swp->setFromPreviousSample();
+    swp->setSample(&(ui2.front()));
+    swp->setSample(&(ui.front()));
+    swp->setSample(&(ui.front()));
+    swp->setSample(&(ui.front()));
+
+    AbcA::ScalarPropertyWriterPtr swp2 =
+        parent->createScalarProperty("float64", AbcA::MetaData(),
+            AbcA::DataType(Alembic::Util::kFloat64POD, 1), 0);
+
+    for ( std::size_t i = 0; i < 300; ++i )
+    {
+        Alembic::Util::float64_t d = i * 0.5;
+        swp2->setSample(&d);
+    }
+
+    AbcA::ScalarPropertyWriterPtr swp3 =
+        parent->createScalarProperty("uint16", AbcA::MetaData(),
+            AbcA::DataType(Alembic::Util::kUint16POD, 1), 0);
+
+    Alembic::Util::uint16_t ui16 = 17;
+    swp3->setSample(&ui16);
+    swp3->setSample(&ui16);
+    swp3->setSample(&ui16);
+
+    // strings are never packed
+    AbcA::ScalarPropertyWriterPtr swp4 =
+        parent->createScalarProperty("str", AbcA::MetaData(),
+            AbcA::DataType(Alembic::Util::kStringPOD, 1), 0);
+
+    Alembic::Util::string str = "hello";
+    Alembic::Util::string str2 = "world";
+    swp4->setSample(&str);
+    swp4->setSample(&str2);
+
+    // no samples at all
+    parent->createScalarProperty("empty", AbcA::MetaData(),
+        AbcA::DataType(Alembic::Util::kBooleanPOD, 1), 0);
+}
+
+//-*****************************************************************************
+void testPackedScalarData()
+{
+    writePackedScalarData( "packedScalarData.abc", true );
+    writePackedScalarData( "unpackedScalarData.abc", false );
+
+    AO::ReadArchive r;
+    AbcA::ArchiveReaderPtr a = r( "packedScalarData.abc" );
+    AbcA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+    TESTING_ASSERT(parent->getNumProperties() == 5);
+
+    AbcA::ScalarPropertyReaderPtr sp = parent->getScalarProperty("int32");
+    TESTING_ASSERT( sp->getNumSamples() == 10 );
+    TESTING_ASSERT( !sp->isConstant() );
+
+    // 0 is ui, 1 is ui2
+    int expected[10] = { 0, 0, 1, 0, 1, 1, 1, 0, 0, 0 };
+    std::vector< Alembic::Util::int32_t > ui(3);
+    for ( std::size_t i = 0; i < 10; ++i )
+    {
+        sp->getSample( i, &(ui.front()) );
+        if ( expected[i] == 0 )
+        {
+            TESTING_ASSERT(ui[0] == 0 && ui[1] == 1 && ui[2] == 2);
+        }
+        else
+        {
+            TESTING_ASSERT(ui[0] == 41 && ui[1] == 43 && ui[2] == 47);
+        }
+    }
+
+    TESTING_ASSERT_THROW(sp->getSample( 10, &(ui.front()) ),
+        Alembic::Util::Exception);
+
+    sp = parent->getScalarProperty("float64");
+    TESTING_ASSERT( sp->getNumSamples() == 300 );
+
+    // read backwards to make sure we don't depend on the order
+    for ( std::size_t i = 300; i > 0; --i )
+    {
+        Alembic::Util::float64_t d = 0.0;
+        sp->getSample( i - 1, &d );
+        TESTING_ASSERT( d == ( i - 1 ) * 0.5 );
+    }
+
+    sp = parent->getScalarProperty("uint16");
+    TESTING_ASSERT( sp->getNumSamples() == 3 );
+    TESTING_ASSERT( sp->isConstant() );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        Alembic::Util::uint16_t us = 0;
+        sp->getSample( i, &us );
+        TESTING_ASSERT( us == 17 );
+    }
+
+    sp = parent->getScalarProperty("str");
+    Alembic::Util::string str;
+    sp->getSample( 0, &str );
+    TESTING_ASSERT( str == "hello" );
+    sp->getSample( 1, &str );
+    TESTING_ASSERT( str == "world" );
+
+    TESTING_ASSERT( parent->getScalarProperty("empty")->getNumSamples() == 0 );
+
+    // packing is purely a storage detail, it shouldn't change the hashes
+    AbcA::ArchiveReaderPtr b = r( "unpackedScalarData.abc" );
+    Alembic::Util::Digest packedDigest, unpackedDigest;
+    TESTING_ASSERT( a->getTop()->getPropertiesHash( packedDigest ) );
+    TESTING_ASSERT( b->getTop()->getPropertiesHash( unpackedDigest ) );
+    TESTING_ASSERT( packedDigest == unpackedDigest );
+}
+
 int main ( int argc, char *argv[] )
 {
     testWeirdStringScalar();
@@ -844,5 +984,6 @@ int main ( int argc, char *argv[] )
     testReadWriteScalars();
     testPropScoping();
     testScalarSamples();
+    testPackedScalarData();
     return 0;
 }
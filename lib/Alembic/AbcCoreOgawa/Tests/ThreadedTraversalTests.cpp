@@ -0,0 +1,311 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <iostream>
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#if !defined(ALEMBIC_LIB_USES_TR1) && __cplusplus >= 201103L
+#define ALEMBIC_TEST_THREADS
+#include <chrono>
+#include <functional>
+#include <thread>
+#endif
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace AbcA = Alembic::AbcCoreAbstract;
+
+static const std::size_t kNumParents = 4;
+static const std::size_t kNumChildren = 2000;
+
+//-*****************************************************************************
+std::string childName( std::size_t iIndex )
+{
+    std::stringstream strm;
+    strm << "child" << iIndex;
+    return strm.str();
+}
+
+//-*****************************************************************************
+void writeWide( const std::string & iArchiveName )
+{
+    AO::WriteArchive w;
+    AbcA::ArchiveWriterPtr a = w( iArchiveName, AbcA::MetaData() );
+    AbcA::ObjectWriterPtr top = a->getTop();
+
+    for ( std::size_t i = 0; i < kNumParents; ++i )
+    {
+        std::stringstream strm;
+        strm << "parent" << i;
+        AbcA::ObjectWriterPtr parent = top->createChild(
+            AbcA::ObjectHeader( strm.str(), AbcA::MetaData() ) );
+
+        for ( std::size_t j = 0; j < kNumChildren; ++j )
+        {
+            AbcA::ObjectWriterPtr child = parent->createChild(
+                AbcA::ObjectHeader( childName( j ), AbcA::MetaData() ) );
+            child->createChild(
+                AbcA::ObjectHeader( "leaf", AbcA::MetaData() ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+// Gets every child of the parents over and over, the children are being
+// held elsewhere so these should all be the existing readers.
+struct ExistingWalker
+{
+    ExistingWalker( const std::vector< AbcA::ObjectReaderPtr > & iParents,
+                    const std::vector< AbcA::ObjectReaderPtr > & iChildren,
+                    std::size_t iPasses )
+      : parents( iParents ), children( iChildren ), passes( iPasses )
+      , ok( true ) {}
+
+    void operator()()
+    {
+        for ( std::size_t p = 0; p < passes; ++p )
+        {
+            for ( std::size_t i = 0; i < parents.size(); ++i )
+            {
+                for ( std::size_t j = 0; j < kNumChildren; ++j )
+                {
+                    // by index on even passes, by name on odd ones
+                    AbcA::ObjectReaderPtr child = ( p % 2 == 0 ) ?
+                        parents[i]->getChild( j ) :
+                        parents[i]->getChild( childName( j ) );
+
+                    if ( child != children[i * kNumChildren + j] )
+                    {
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+
+    const std::vector< AbcA::ObjectReaderPtr > & parents;
+    const std::vector< AbcA::ObjectReaderPtr > & children;
+    std::size_t passes;
+    bool ok;
+};
+
+//-*****************************************************************************
+// The same walk as ExistingWalker, with each child behind its own
+// mutex the way every getChild used to be, to compare against.
+struct LockedWalker
+{
+    LockedWalker( const std::vector< AbcA::ObjectReaderPtr > & iParents,
+                  const std::vector< AbcA::ObjectReaderPtr > & iChildren,
+                  std::vector< Alembic::Util::mutex > & iLocks,
+                  std::size_t iPasses )
+      : parents( iParents ), children( iChildren ), locks( iLocks )
+      , passes( iPasses ), ok( true ) {}
+
+    void operator()()
+    {
+        for ( std::size_t p = 0; p < passes; ++p )
+        {
+            for ( std::size_t i = 0; i < parents.size(); ++i )
+            {
+                for ( std::size_t j = 0; j < kNumChildren; ++j )
+                {
+                    std::size_t k = i * kNumChildren + j;
+                    Alembic::Util::scoped_lock l( locks[k] );
+                    AbcA::ObjectReaderPtr child = ( p % 2 == 0 ) ?
+                        parents[i]->getChild( j ) :
+                        parents[i]->getChild( childName( j ) );
+
+                    if ( child != children[k] )
+                    {
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+
+    const std::vector< AbcA::ObjectReaderPtr > & parents;
+    const std::vector< AbcA::ObjectReaderPtr > & children;
+    std::vector< Alembic::Util::mutex > & locks;
+    std::size_t passes;
+    bool ok;
+};
+
+//-*****************************************************************************
+// Gets the children and lets go of them right away, so they are constantly
+// being remade while other threads are doing the same.
+struct ChurningWalker
+{
+    ChurningWalker( const std::vector< AbcA::ObjectReaderPtr > & iParents,
+                    std::size_t iPasses )
+      : parents( iParents ), passes( iPasses ), ok( true ) {}
+
+    void operator()()
+    {
+        for ( std::size_t p = 0; p < passes; ++p )
+        {
+            for ( std::size_t i = 0; i < parents.size(); ++i )
+            {
+                for ( std::size_t j = 0; j < kNumChildren; j += 7 )
+                {
+                    AbcA::ObjectReaderPtr child = parents[i]->getChild( j );
+                    if ( !child || child->getName() != childName( j ) ||
+                         child->getNumChildren() != 1 ||
+                         child->getChild( 0 )->getFullName() !=
+                         child->getFullName() + "/leaf" )
+                    {
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+
+    const std::vector< AbcA::ObjectReaderPtr > & parents;
+    std::size_t passes;
+    bool ok;
+};
+
+#ifdef ALEMBIC_TEST_THREADS
+//-*****************************************************************************
+template < class WALKER >
+double runWalkers( std::vector< WALKER > & ioWalkers )
+{
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    std::vector< std::thread > threads;
+    for ( std::size_t i = 0; i < ioWalkers.size(); ++i )
+    {
+        threads.push_back( std::thread( std::ref( ioWalkers[i] ) ) );
+    }
+
+    for ( std::size_t i = 0; i < threads.size(); ++i )
+    {
+        threads[i].join();
+    }
+
+    for ( std::size_t i = 0; i < ioWalkers.size(); ++i )
+    {
+        TESTING_ASSERT( ioWalkers[i].ok );
+    }
+
+    return std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start ).count();
+}
+#endif
+
+//-*****************************************************************************
+void testConcurrentTraversal()
+{
+    std::string archiveName = "threadedTraversalTest.abc";
+    writeWide( archiveName );
+
+    AO::ReadArchive r( 4 );
+    AbcA::ArchiveReaderPtr a = r( archiveName );
+    AbcA::ObjectReaderPtr top = a->getTop();
+    TESTING_ASSERT( top->getNumChildren() == kNumParents );
+
+    std::vector< AbcA::ObjectReaderPtr > parents;
+    std::vector< AbcA::ObjectReaderPtr > children;
+    for ( std::size_t i = 0; i < kNumParents; ++i )
+    {
+        parents.push_back( top->getChild( i ) );
+        TESTING_ASSERT( parents[i]->getNumChildren() == kNumChildren );
+        for ( std::size_t j = 0; j < kNumChildren; ++j )
+        {
+            children.push_back( parents[i]->getChild( j ) );
+        }
+    }
+
+    const std::size_t passes = 50;
+
+#ifdef ALEMBIC_TEST_THREADS
+    std::size_t maxThreads = std::thread::hardware_concurrency();
+    maxThreads = std::max( maxThreads, ( std::size_t ) 2 );
+
+    // the same total amount of work split over more threads, with and
+    // without a lock per child
+    std::vector< Alembic::Util::mutex > locks( children.size() );
+    for ( std::size_t numThreads = 1; numThreads <= maxThreads;
+          numThreads *= 2 )
+    {
+        std::vector< LockedWalker > lockedWalkers( numThreads,
+            LockedWalker( parents, children, locks,
+                          passes / numThreads + 1 ) );
+        double lockedSeconds = runWalkers( lockedWalkers );
+
+        std::vector< ExistingWalker > walkers( numThreads,
+            ExistingWalker( parents, children, passes / numThreads + 1 ) );
+        double seconds = runWalkers( walkers );
+
+        std::cout << "existing children, " << numThreads << " threads: "
+                  << seconds << "s, locked: " << lockedSeconds << "s"
+                  << std::endl;
+    }
+
+    // drop all of the children so they get made and released concurrently
+    children.clear();
+    std::vector< ChurningWalker > churners( maxThreads,
+                                            ChurningWalker( parents, 10 ) );
+    double seconds = runWalkers( churners );
+    std::cout << "remade children, " << maxThreads << " threads: "
+              << seconds << "s" << std::endl;
+#else
+    ExistingWalker walker( parents, children, passes );
+    walker();
+    TESTING_ASSERT( walker.ok );
+
+    children.clear();
+    ChurningWalker churner( parents, 10 );
+    churner();
+    TESTING_ASSERT( churner.ok );
+#endif
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    testConcurrentTraversal();
+    return 0;
+}
@@ -36,11 +36,16 @@
 
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+// array samples smaller than this aren't worth compressing
+static const Util::uint64_t MIN_COMPRESSED_SIZE = 256;
+
 //-*****************************************************************************
 void pushUint32WithHint( std::vector< Util::uint8_t > & ioData,
                          Util::uint32_t iVal, Util::uint32_t iHint )
@@ -183,7 +188,9 @@ WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey )
+           const AbcA::ArraySample::Key &iKey,
+           bool iCompressed,
+           Util::int8_t iCompressionHint )
 {
 
     // Okay, need to actually store it.
@@ -191,9 +198,12 @@ WriteData( WrittenSampleMap &iMap,
 
     const AbcA::Dimensions & dims = iSamp.getDimensions();
 
-    // See whether or not we've already stored this.
+    // See whether or not we've already stored this, the data can only be
+    // shared if it was written with the same layout, the empty data is
+    // the same in both
     WrittenSampleIDPtr writeID = iMap.find( iKey );
-    if ( writeID )
+    if ( writeID && ( writeID->isCompressed() == iCompressed ||
+                      iKey.numBytes == 0 ) )
     {
         CopyWrittenData( iGroup, writeID );
         return writeID;
@@ -257,6 +267,37 @@ WriteData( WrittenSampleMap &iMap,
             v.size() * sizeof(Util::int32_t) };
         dataPtr =  iGroup->addData( 2, sizes, datas );
     }
+    else if ( iCompressed )
+    {
+        // the uncompressed size is always written so that the data can be
+        // told apart from the compressed data, which is always smaller
+        Alembic::Util::uint64_t numBytes = iKey.numBytes;
+        const void * payload = iSamp.getData();
+        Alembic::Util::uint64_t payloadSize = numBytes;
+
+        Alembic::Util::PlainOldDataType pod = dataType.getPod();
+        std::size_t shuffleSize = 0;
+        if ( pod == Alembic::Util::kFloat16POD ||
+             pod == Alembic::Util::kFloat32POD ||
+             pod == Alembic::Util::kFloat64POD )
+        {
+            shuffleSize = Alembic::Util::PODNumBytes( pod );
+        }
+
+        std::vector< Util::uint8_t > compressed;
+        if ( iCompressionHint >= 0 && numBytes >= MIN_COMPRESSED_SIZE &&
+             Util::Compress( iSamp.getData(), numBytes, shuffleSize,
+                             iCompressionHint, compressed ) )
+        {
+            payload = &compressed.front();
+            payloadSize = compressed.size();
+        }
+
+        const void * datas[3] = { &iKey.digest, &numBytes, payload };
+        Alembic::Util::uint64_t sizes[3] = { 16, 8, payloadSize };
+
+        dataPtr = iGroup->addData( 3, sizes, datas );
+    }
     else
     {
         const void * datas[2] = { &iKey.digest, iSamp.getData() };
@@ -266,13 +307,70 @@ WriteData( WrittenSampleMap &iMap,
     }
 
     writeID.reset( new WrittenSampleID( iKey, dataPtr,
-                        dataType.getExtent() * dims.numPoints() ) );
+                        dataType.getExtent() * dims.numPoints(),
+                        iCompressed ) );
     iMap.store( writeID );
 
     // Return the reference.
     return writeID;
 }
 
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteDeltaData( Ogawa::OGroupPtr iGroup,
+                const AbcA::ArraySample &iSamp,
+                const AbcA::ArraySample::Key &iKey,
+                const Util::uint8_t * iBase,
+                Util::uint32_t iBaseIndex,
+                Util::int8_t iCompressionHint )
+{
+    Alembic::Util::uint64_t numBytes = iKey.numBytes;
+    const Util::uint8_t * data =
+        static_cast< const Util::uint8_t * >( iSamp.getData() );
+
+    // too small to be worth the trouble of decoding later
+    if ( numBytes < MIN_COMPRESSED_SIZE )
+    {
+        iBase = NULL;
+    }
+
+    Util::uint32_t base = 0;
+    std::vector< Util::uint8_t > delta;
+    if ( iBase )
+    {
+        base = iBaseIndex + 1;
+        delta.resize( numBytes );
+        for ( std::size_t i = 0; i < numBytes; ++i )
+        {
+            delta[i] = data[i] ^ iBase[i];
+        }
+        data = &delta.front();
+    }
+
+    const AbcA::DataType &dataType = iSamp.getDataType();
+    std::size_t shuffleSize = Alembic::Util::PODNumBytes( dataType.getPod() );
+
+    const void * payload = data;
+    Alembic::Util::uint64_t payloadSize = numBytes;
+
+    std::vector< Util::uint8_t > compressed;
+    if ( iCompressionHint >= 0 && numBytes >= MIN_COMPRESSED_SIZE &&
+         Util::Compress( data, numBytes, shuffleSize, iCompressionHint,
+                         compressed ) )
+    {
+        payload = &compressed.front();
+        payloadSize = compressed.size();
+    }
+
+    const void * datas[4] = { &iKey.digest, &numBytes, &base, payload };
+    Alembic::Util::uint64_t sizes[4] = { 16, 8, 4, payloadSize };
+
+    Ogawa::ODataPtr dataPtr = iGroup->addData( 4, sizes, datas );
+
+    return WrittenSampleIDPtr( new WrittenSampleID( iKey, dataPtr,
+        dataType.getExtent() * iSamp.getDimensions().numPoints(), true ) );
+}
+
 //-*****************************************************************************
 void CopyWrittenData( Ogawa::OGroupPtr iGroup,
                       WrittenSampleIDPtr iRef )
@@ -291,6 +389,9 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                     const AbcA::PropertyHeader &iHeader,
                     bool isScalarLike,
                     bool isHomogenous,
+                    bool isPacked,
+                    bool isCompressed,
+                    bool isDelta,
                     Util::uint32_t iTimeSamplingIndex,
                     Util::uint32_t iNumSamples,
                     Util::uint32_t iFirstChangedIndex,
@@ -345,6 +446,15 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Whether the scalar samples are packed into one data block 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Whether the array samples may be compressed 0x20000000
+    // 0010 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Whether the array samples may be delta encoded 0x40000000
+    // 0100 0000 0000 0000 0000 0000 0000 0000
 
     std::string metaData = iHeader.getMetaData().serialize();
     Util::uint32_t metaDataSize = metaData.size();
@@ -429,6 +539,21 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
             info |= 0x400;
         }
 
+        if ( isPacked )
+        {
+            info |= 0x10000000;
+        }
+
+        if ( isCompressed )
+        {
+            info |= 0x20000000;
+        }
+
+        if ( isDelta )
+        {
+            info |= 0x40000000;
+        }
+
         ABCA_ASSERT( iFirstChangedIndex <= iNumSamples &&
             iLastChangedIndex <= iNumSamples &&
             iFirstChangedIndex <= iLastChangedIndex,
@@ -536,6 +661,236 @@ void WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
 
 }
 
+//-*****************************************************************************
+void CopyExistingGroup( Ogawa::OGroupPtr iGroup,
+                        Ogawa::IGroupPtr iExisting )
+{
+    Util::uint64_t numChildren = iExisting->getNumChildren();
+    for ( Util::uint64_t i = 0; i < numChildren; ++i )
+    {
+        if ( iExisting->isChildGroup( i ) )
+        {
+            // we only need the position, so don't read the child indices
+            iGroup->addGroup( iExisting->getGroup( i, true, 0 ) );
+        }
+        else
+        {
+            iGroup->addData( iExisting->getData( i, 0 ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+AbcA::ArraySample::Key ReadExistingKey( Ogawa::IDataPtr iData,
+                                        const AbcA::DataType & iDataType,
+                                        const AbcA::Dimensions & iDims )
+{
+    AbcA::ArraySample::Key key;
+    key.numBytes = 0;
+
+    Alembic::Util::PlainOldDataType pod = iDataType.getPod();
+    if ( pod != Alembic::Util::kStringPOD &&
+         pod != Alembic::Util::kWstringPOD )
+    {
+        pod = Alembic::Util::kInt8POD;
+    }
+
+    key.origPOD = pod;
+    key.readPOD = pod;
+
+    // empty samples all share the same empty data, see AwImpl::init
+    if ( iData->getSize() < 16 )
+    {
+        return key;
+    }
+
+    iData->read( 16, key.digest.d, 0, 0 );
+
+    // the key for strings uses the in memory size, and the data of
+    // everything else may have been compressed
+    key.numBytes = iDataType.getNumBytes() * iDims.numPoints();
+
+    return key;
+}
+
+//-*****************************************************************************
+Util::Digest HashExistingSamples( Ogawa::IGroupPtr iGroup,
+                                  PropertyHeaderAndFriends & iHeader )
+{
+    Util::Digest hash;
+    if ( iHeader.nextSampleIndex == 0 )
+    {
+        return hash;
+    }
+
+    const AbcA::DataType & dataType = iHeader.header.getDataType();
+
+    // the digest of each sample that was actually written
+    std::vector< Util::Digest > digests;
+
+    if ( iHeader.isPacked )
+    {
+        Ogawa::IDataPtr data = iGroup->getData( 0, 0 );
+        ABCA_ASSERT( data && data->getSize() > 16,
+            "Invalid packed scalar data for: " << iHeader.header.getName() );
+
+        std::vector< Util::uint8_t > buf( data->getSize() - 16 );
+        data->read( buf.size(), &buf.front(), 16, 0 );
+
+        size_t numBytes = dataType.getNumBytes();
+        for ( size_t pos = 0; pos + numBytes <= buf.size(); pos += numBytes )
+        {
+            AbcA::ArraySample samp( &buf[pos], dataType,
+                                    AbcA::Dimensions( 1 ) );
+            digests.push_back( samp.getKey().digest );
+        }
+    }
+    else if ( iHeader.header.isArray() )
+    {
+        Util::uint64_t numData = iGroup->getNumChildren() / 2;
+        for ( Util::uint64_t i = 0; i < numData; ++i )
+        {
+            Ogawa::IDataPtr data = iGroup->getData( i * 2, 0 );
+            AbcA::Dimensions dims;
+            ReadDimensions( iGroup->getData( i * 2 + 1, 0 ), data, 0,
+                            dataType, iHeader.isCompressed, dims );
+
+            Util::Digest digest = ReadExistingKey( data, dataType, dims ).digest;
+            HashDimensions( dims, digest );
+            digests.push_back( digest );
+        }
+    }
+    else
+    {
+        Util::uint64_t numData = iGroup->getNumChildren();
+        for ( Util::uint64_t i = 0; i < numData; ++i )
+        {
+            digests.push_back( ReadExistingKey( iGroup->getData( i, 0 ),
+                dataType, AbcA::Dimensions( 1 ) ).digest );
+        }
+    }
+
+    // chain them together just like setSample and setFromPreviousSample do
+    for ( Util::uint32_t i = 0; i < iHeader.nextSampleIndex; ++i )
+    {
+        size_t index = iHeader.verifyIndex( i );
+        ABCA_ASSERT( index < digests.size(),
+            "Missing sample data for: " << iHeader.header.getName() );
+
+        Util::Digest digest = digests[index];
+        if ( i == 0 )
+        {
+            hash = digest;
+        }
+        else
+        {
+            Util::SpookyHash::ShortEnd( hash.words[0], hash.words[1],
+                                        digest.words[0], digest.words[1] );
+        }
+    }
+
+    return hash;
+}
+
+//-*****************************************************************************
+void HashExistingProperty( Ogawa::IGroupPtr iGroup,
+                           PropertyHeaderAndFriends & iHeader,
+                           AbcA::ArchiveReader & iArchive,
+                           const std::vector< AbcA::MetaData > & iMetaDataVec,
+                           Util::uint64_t & oHash0,
+                           Util::uint64_t & oHash1 )
+{
+    Util::SpookyHash hash;
+    hash.Init( 0, 0 );
+
+    if ( iHeader.header.isCompound() )
+    {
+        PropertyHeaderPtrs headers;
+        Util::uint64_t numChildren = iGroup->getNumChildren();
+        if ( numChildren > 0 )
+        {
+            ReadPropertyHeaders( iGroup, numChildren - 1, 0, iArchive,
+                                 iMetaDataVec, headers );
+        }
+
+        std::vector< Util::uint64_t > hashes( headers.size() * 2 );
+        for ( size_t i = 0; i < headers.size(); ++i )
+        {
+            HashExistingProperty( iGroup->getGroup( i, false, 0 ),
+                                  *headers[i], iArchive, iMetaDataVec,
+                                  hashes[i * 2], hashes[i * 2 + 1] );
+        }
+
+        // same order as CpwImpl
+        if ( !hashes.empty() )
+        {
+            hash.Update( &hashes.front(), hashes.size() * 8 );
+        }
+        HashPropertyHeader( iHeader.header, hash );
+    }
+    else
+    {
+        // same order as SpwImpl and ApwImpl
+        HashPropertyHeader( iHeader.header, hash );
+        if ( iHeader.nextSampleIndex != 0 )
+        {
+            Util::Digest digest = HashExistingSamples( iGroup, iHeader );
+            hash.Update( digest.d, 16 );
+        }
+    }
+
+    hash.Final( &oHash0, &oHash1 );
+}
+
+//-*****************************************************************************
+void HashExistingObject( Ogawa::IGroupPtr iGroup,
+                         const AbcA::ObjectHeader & iHeader,
+                         const std::vector< AbcA::MetaData > & iMetaDataVec,
+                         Util::uint64_t & oHash0,
+                         Util::uint64_t & oHash1 )
+{
+    Util::uint64_t numChildren = iGroup->getNumChildren();
+    ABCA_ASSERT( numChildren > 0 && iGroup->isChildData( numChildren - 1 ),
+        "Invalid object data for: " << iHeader.getFullName() );
+
+    std::vector< ObjectHeaderPtr > headers;
+    ReadObjectHeaders( iGroup, numChildren - 1, 0, iHeader.getFullName(),
+                       iMetaDataVec, headers );
+
+    std::vector< Util::uint64_t > hashes( headers.size() * 2 );
+    for ( size_t i = 0; i < headers.size(); ++i )
+    {
+        HashExistingObject( iGroup->getGroup( i + 1, false, 0 ), *headers[i],
+                            iMetaDataVec, hashes[i * 2], hashes[i * 2 + 1] );
+    }
+
+    // the data hash is the first half of the last 32 bytes
+    Ogawa::IDataPtr data = iGroup->getData( numChildren - 1, 0 );
+    ABCA_ASSERT( data->getSize() >= 32,
+        "Invalid object hashes for: " << iHeader.getFullName() );
+
+    Util::uint64_t dataHash[2];
+    data->read( 16, dataHash, data->getSize() - 32, 0 );
+
+    // same order as OwData::writeHeaders and OwImpl
+    Util::SpookyHash hash;
+    hash.Init( 0, 0 );
+    if ( !hashes.empty() )
+    {
+        hash.Update( &hashes.front(), hashes.size() * 8 );
+    }
+    hash.Update( dataHash, 16 );
+
+    std::string metaDataStr = iHeader.getMetaData().serialize();
+    if ( !metaDataStr.empty() )
+    {
+        hash.Update( &( metaDataStr[0] ), metaDataStr.size() );
+    }
+
+    hash.Update( &( iHeader.getName()[0] ), iHeader.getName().size() );
+    hash.Final( &oHash0, &oHash1 );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
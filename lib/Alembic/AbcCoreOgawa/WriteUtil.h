@@ -71,11 +71,31 @@ CopyWrittenData( Ogawa::OGroupPtr iParent,
                  WrittenSampleIDPtr iRef );
 
 //-*****************************************************************************
+// If iCompressed the sample is written with the compressed layout, see
+// PropertyHeaderAndFriends::isCompressed, and a non negative
+// iCompressionHint is used as the compression level.
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey );
+           const AbcA::ArraySample::Key &iKey,
+           bool iCompressed = false,
+           Util::int8_t iCompressionHint = -1 );
+
+//-*****************************************************************************
+// Writes a non empty sample of a delta encoded property, see
+// PropertyHeaderAndFriends::isDelta.  If iBase isn't NULL it has to hold the
+// sample which was written at storage index iBaseIndex, with the same number
+// of bytes, and the sample is XORed against it.  Otherwise the sample is
+// written as a key frame.  These samples are never shared with other
+// properties so they aren't added to a WrittenSampleMap.
+WrittenSampleIDPtr
+WriteDeltaData( Ogawa::OGroupPtr iGroup,
+                const AbcA::ArraySample &iSamp,
+                const AbcA::ArraySample::Key &iKey,
+                const Util::uint8_t * iBase,
+                Util::uint32_t iBaseIndex,
+                Util::int8_t iCompressionHint );
 
 //-*****************************************************************************
 void
@@ -83,6 +103,9 @@ WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                    const AbcA::PropertyHeader &iHeader,
                    bool isScalarLike,
                    bool isHomogenous,
+                   bool isPacked,
+                   bool isCompressed,
+                   bool isDelta,
                    Util::uint32_t iTimeSamplingIndex,
                    Util::uint32_t iNumSamples,
                    Util::uint32_t iFirstChangedIndex,
@@ -101,6 +124,50 @@ WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
                    Util::uint32_t  iMaxSample,
                    const AbcA::TimeSampling &iTsmp );
 
+//-*****************************************************************************
+// The functions below are used when appending to an existing archive.
+//-*****************************************************************************
+
+//-*****************************************************************************
+// reference all of the children of an already written group from iGroup
+void
+CopyExistingGroup( Ogawa::OGroupPtr iGroup,
+                   Ogawa::IGroupPtr iExisting );
+
+//-*****************************************************************************
+// rebuild the key of an already written sample the same way setSample
+// would have masked it
+AbcA::ArraySample::Key
+ReadExistingKey( Ogawa::IDataPtr iData,
+                 const AbcA::DataType & iDataType,
+                 const AbcA::Dimensions & iDims );
+
+//-*****************************************************************************
+// recompute the accumulated sample hash of an already written scalar or
+// array property
+Util::Digest
+HashExistingSamples( Ogawa::IGroupPtr iGroup,
+                     PropertyHeaderAndFriends & iHeader );
+
+//-*****************************************************************************
+// recompute the hash that a property writer would have given its parent
+void
+HashExistingProperty( Ogawa::IGroupPtr iGroup,
+                      PropertyHeaderAndFriends & iHeader,
+                      AbcA::ArchiveReader & iArchive,
+                      const std::vector< AbcA::MetaData > & iMetaDataVec,
+                      Util::uint64_t & oHash0,
+                      Util::uint64_t & oHash1 );
+
+//-*****************************************************************************
+// recompute the hash that an object writer would have given its parent
+void
+HashExistingObject( Ogawa::IGroupPtr iGroup,
+                    const AbcA::ObjectHeader & iHeader,
+                    const std::vector< AbcA::MetaData > & iMetaDataVec,
+                    Util::uint64_t & oHash0,
+                    Util::uint64_t & oHash1 );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -62,12 +62,15 @@ public:
         m_sampleKey.origPOD = Alembic::Util::kInt8POD;
         m_sampleKey.readPOD = Alembic::Util::kInt8POD;
         m_numPoints = 0;
+        m_compressed = false;
     }
 
     WrittenSampleID( const AbcA::ArraySample::Key &iKey,
                      Ogawa::ODataPtr iData,
-                     std::size_t iNumPoints )
+                     std::size_t iNumPoints,
+                     bool iCompressed = false )
       : m_sampleKey( iKey ), m_data( iData ), m_numPoints( iNumPoints )
+      , m_compressed( iCompressed )
     {
     }
 
@@ -77,10 +80,15 @@ public:
 
     std::size_t getNumPoints() { return m_numPoints; }
 
+    // whether the data was written with the compressed sample layout
+    // see PropertyHeaderAndFriends::isCompressed
+    bool isCompressed() const { return m_compressed; }
+
 private:
     AbcA::ArraySample::Key m_sampleKey;
     Ogawa::ODataPtr m_data;
     std::size_t m_numPoints;
+    bool m_compressed;
 };
 
 //-*****************************************************************************
@@ -79,6 +79,9 @@
 #include <Alembic/AbcGeom/XformSample.h>
 #include <Alembic/AbcGeom/OXform.h>
 #include <Alembic/AbcGeom/IXform.h>
+#include <Alembic/AbcGeom/IWorldXformEvaluator.h>
+#include <Alembic/AbcGeom/IBoundsIndex.h>
+#include <Alembic/AbcGeom/IVisibilityEvaluator.h>
 
 #include <Alembic/AbcGeom/Visibility.h>
 
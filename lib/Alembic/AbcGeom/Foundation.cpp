@@ -0,0 +1,339 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/Foundation.h>
+
+#include <algorithm>
+#include <limits>
+
+#if defined( __AVX__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || \
+    ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define ALEMBIC_ABCGEOM_SSE2_BOUNDS
+#include <emmintrin.h>
+#endif
+
+#if !defined( ALEMBIC_LIB_USES_TR1 ) && __cplusplus >= 201103L
+#define ALEMBIC_ABCGEOM_PARALLEL_BOUNDS
+#include <thread>
+#endif
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// Each of these does min and max on a register of width values.  The new
+// values always go in the first argument, so like Box3d::extendBy, a NaN
+// never makes it into the running min or max.
+template <class T>
+struct ScalarMinMax
+{
+    typedef T value_type;
+    typedef T reg_type;
+    static const size_t width = 1;
+
+    static reg_type splat( T iVal ) { return iVal; }
+    static reg_type load( const T * iPtr ) { return *iPtr; }
+    static void store( T * oPtr, reg_type iVal ) { *oPtr = iVal; }
+    static reg_type min( reg_type iNew, reg_type iCur )
+    { return iNew < iCur ? iNew : iCur; }
+    static reg_type max( reg_type iNew, reg_type iCur )
+    { return iNew > iCur ? iNew : iCur; }
+};
+
+#if defined( __AVX__ )
+
+struct FloatMinMax
+{
+    typedef float value_type;
+    typedef __m256 reg_type;
+    static const size_t width = 8;
+
+    static reg_type splat( float iVal ) { return _mm256_set1_ps( iVal ); }
+    static reg_type load( const float * iPtr )
+    { return _mm256_loadu_ps( iPtr ); }
+    static void store( float * oPtr, reg_type iVal )
+    { _mm256_storeu_ps( oPtr, iVal ); }
+    static reg_type min( reg_type iNew, reg_type iCur )
+    { return _mm256_min_ps( iNew, iCur ); }
+    static reg_type max( reg_type iNew, reg_type iCur )
+    { return _mm256_max_ps( iNew, iCur ); }
+};
+
+struct DoubleMinMax
+{
+    typedef double value_type;
+    typedef __m256d reg_type;
+    static const size_t width = 4;
+
+    static reg_type splat( double iVal ) { return _mm256_set1_pd( iVal ); }
+    static reg_type load( const double * iPtr )
+    { return _mm256_loadu_pd( iPtr ); }
+    static void store( double * oPtr, reg_type iVal )
+    { _mm256_storeu_pd( oPtr, iVal ); }
+    static reg_type min( reg_type iNew, reg_type iCur )
+    { return _mm256_min_pd( iNew, iCur ); }
+    static reg_type max( reg_type iNew, reg_type iCur )
+    { return _mm256_max_pd( iNew, iCur ); }
+};
+
+#elif defined( ALEMBIC_ABCGEOM_SSE2_BOUNDS )
+
+struct FloatMinMax
+{
+    typedef float value_type;
+    typedef __m128 reg_type;
+    static const size_t width = 4;
+
+    static reg_type splat( float iVal ) { return _mm_set1_ps( iVal ); }
+    static reg_type load( const float * iPtr ) { return _mm_loadu_ps( iPtr ); }
+    static void store( float * oPtr, reg_type iVal )
+    { _mm_storeu_ps( oPtr, iVal ); }
+    static reg_type min( reg_type iNew, reg_type iCur )
+    { return _mm_min_ps( iNew, iCur ); }
+    static reg_type max( reg_type iNew, reg_type iCur )
+    { return _mm_max_ps( iNew, iCur ); }
+};
+
+struct DoubleMinMax
+{
+    typedef double value_type;
+    typedef __m128d reg_type;
+    static const size_t width = 2;
+
+    static reg_type splat( double iVal ) { return _mm_set1_pd( iVal ); }
+    static reg_type load( const double * iPtr )
+    { return _mm_loadu_pd( iPtr ); }
+    static void store( double * oPtr, reg_type iVal )
+    { _mm_storeu_pd( oPtr, iVal ); }
+    static reg_type min( reg_type iNew, reg_type iCur )
+    { return _mm_min_pd( iNew, iCur ); }
+    static reg_type max( reg_type iNew, reg_type iCur )
+    { return _mm_max_pd( iNew, iCur ); }
+};
+
+#else
+
+typedef ScalarMinMax< float > FloatMinMax;
+typedef ScalarMinMax< double > DoubleMinMax;
+
+#endif
+
+//-*****************************************************************************
+// The min and max of iNumPoints xyz points packed one after another.
+//
+// width points take up 3 registers, so rather than shuffling the
+// components apart every register keeps its own running min and max.
+// Lane i of register r always holds component ( r * width + i ) % 3, which
+// gets sorted out once at the end.
+template <class OPS>
+void MinMaxPoints( const typename OPS::value_type * iData, size_t iNumPoints,
+                   typename OPS::value_type oMin[3],
+                   typename OPS::value_type oMax[3] )
+{
+    typedef typename OPS::value_type T;
+    typedef typename OPS::reg_type R;
+    const size_t width = OPS::width;
+
+    const T inf = std::numeric_limits< T >::infinity();
+
+    R mins[3];
+    R maxs[3];
+    for ( size_t r = 0; r < 3; ++r )
+    {
+        mins[r] = OPS::splat( inf );
+        maxs[r] = OPS::splat( -inf );
+    }
+
+    size_t numBlocks = iNumPoints / width;
+    const T * data = iData;
+    for ( size_t b = 0; b < numBlocks; ++b, data += 3 * width )
+    {
+        R v0 = OPS::load( data );
+        R v1 = OPS::load( data + width );
+        R v2 = OPS::load( data + 2 * width );
+        mins[0] = OPS::min( v0, mins[0] );
+        maxs[0] = OPS::max( v0, maxs[0] );
+        mins[1] = OPS::min( v1, mins[1] );
+        maxs[1] = OPS::max( v1, maxs[1] );
+        mins[2] = OPS::min( v2, mins[2] );
+        maxs[2] = OPS::max( v2, maxs[2] );
+    }
+
+    T laneMins[3 * width];
+    T laneMaxs[3 * width];
+    for ( size_t r = 0; r < 3; ++r )
+    {
+        OPS::store( laneMins + r * width, mins[r] );
+        OPS::store( laneMaxs + r * width, maxs[r] );
+    }
+
+    typedef ScalarMinMax< T > S;
+    for ( size_t c = 0; c < 3; ++c )
+    {
+        oMin[c] = inf;
+        oMax[c] = -inf;
+    }
+
+    for ( size_t i = 0; i < 3 * width; ++i )
+    {
+        oMin[i % 3] = S::min( laneMins[i], oMin[i % 3] );
+        oMax[i % 3] = S::max( laneMaxs[i], oMax[i % 3] );
+    }
+
+    // whatever didn't fill a whole block
+    size_t numLeft = ( iNumPoints - numBlocks * width ) * 3;
+    for ( size_t i = 0; i < numLeft; ++i )
+    {
+        oMin[i % 3] = S::min( data[i], oMin[i % 3] );
+        oMax[i % 3] = S::max( data[i], oMax[i % 3] );
+    }
+}
+
+//-*****************************************************************************
+// Below this many points per thread, starting the threads costs more
+// than they save.
+const size_t kMinPointsPerThread = 256 * 1024;
+
+template <class OPS>
+Abc::Box3d ComputeBounds( const typename OPS::value_type * iData,
+                          size_t iNumPoints )
+{
+    typedef typename OPS::value_type T;
+
+    T bmin[3];
+    T bmax[3];
+
+    size_t numThreads = 1;
+
+#ifdef ALEMBIC_ABCGEOM_PARALLEL_BOUNDS
+    numThreads = std::min( ( size_t ) std::thread::hardware_concurrency(),
+                           iNumPoints / kMinPointsPerThread );
+#endif
+
+    if ( numThreads < 2 )
+    {
+        MinMaxPoints< OPS >( iData, iNumPoints, bmin, bmax );
+    }
+#ifdef ALEMBIC_ABCGEOM_PARALLEL_BOUNDS
+    else
+    {
+        std::vector< T > mins( numThreads * 3 );
+        std::vector< T > maxs( numThreads * 3 );
+        std::vector< std::thread > threads;
+
+        size_t chunk = iNumPoints / numThreads;
+        for ( size_t t = 1; t < numThreads; ++t )
+        {
+            size_t start = t * chunk;
+            size_t count = ( t + 1 == numThreads ) ?
+                iNumPoints - start : chunk;
+            threads.push_back( std::thread( MinMaxPoints< OPS >,
+                iData + start * 3, count, &mins[t * 3], &maxs[t * 3] ) );
+        }
+
+        MinMaxPoints< OPS >( iData, chunk, &mins[0], &maxs[0] );
+
+        for ( size_t t = 0; t < threads.size(); ++t )
+        {
+            threads[t].join();
+        }
+
+        typedef ScalarMinMax< T > S;
+        for ( size_t c = 0; c < 3; ++c )
+        {
+            bmin[c] = mins[c];
+            bmax[c] = maxs[c];
+            for ( size_t t = 1; t < numThreads; ++t )
+            {
+                bmin[c] = S::min( mins[t * 3 + c], bmin[c] );
+                bmax[c] = S::max( maxs[t * 3 + c], bmax[c] );
+            }
+        }
+    }
+#endif
+
+    // a component that never saw a number (no points, or all NaN) stays
+    // empty just like it would with Box3d::extendBy
+    Abc::Box3d ret;
+    const T inf = std::numeric_limits< T >::infinity();
+    for ( size_t c = 0; c < 3; ++c )
+    {
+        if ( bmin[c] != inf || bmax[c] != -inf )
+        {
+            ret.min[c] = bmin[c];
+            ret.max[c] = bmax[c];
+        }
+    }
+
+    return ret;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Abc::Box3d ComputeBoundsFromPositions( const Abc::V3f * iPositions,
+                                       size_t iNumPositions )
+{
+    if ( iNumPositions == 0 )
+    {
+        return Abc::Box3d();
+    }
+
+    return ComputeBounds< FloatMinMax >(
+        reinterpret_cast< const float * >( iPositions ), iNumPositions );
+}
+
+//-*****************************************************************************
+Abc::Box3d ComputeBoundsFromPositions( const Abc::V3d * iPositions,
+                                       size_t iNumPositions )
+{
+    if ( iNumPositions == 0 )
+    {
+        return Abc::Box3d();
+    }
+
+    return ComputeBounds< DoubleMinMax >(
+        reinterpret_cast< const double * >( iPositions ), iNumPositions );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -37,6 +37,7 @@
 #ifndef _Alembic_AbcGeom_Foundation_h_
 #define _Alembic_AbcGeom_Foundation_h_
 
+#include <Alembic/Util/Export.h>
 #include <Alembic/Abc/All.h>
 
 #include <ImathMatrixAlgo.h>
@@ -132,6 +133,39 @@ inline void SetPropUsePrevIfNull<Abc::OBox3dProperty, Abc::Box3d>(
     else { iProp.setFromPrevious(); }
 }
 
+//-*****************************************************************************
+//! Computes an axis-aligned bounding box from packed positions.  The
+//! min/max reduction uses SSE2 or AVX when they are available and is split
+//! across threads for very large arrays.  NaN components are skipped, just
+//! like Box3d::extendBy.
+ALEMBIC_EXPORT Abc::Box3d
+ComputeBoundsFromPositions( const Abc::V3f * iPositions,
+                            size_t iNumPositions );
+
+ALEMBIC_EXPORT Abc::Box3d
+ComputeBoundsFromPositions( const Abc::V3d * iPositions,
+                            size_t iNumPositions );
+
+inline Abc::Box3d ComputeBoundsFromPositions( const Abc::P3fArraySample &iSamp )
+{
+    return ComputeBoundsFromPositions( iSamp.get(), iSamp.size() );
+}
+
+inline Abc::Box3d ComputeBoundsFromPositions( const Abc::V3fArraySample &iSamp )
+{
+    return ComputeBoundsFromPositions( iSamp.get(), iSamp.size() );
+}
+
+inline Abc::Box3d ComputeBoundsFromPositions( const Abc::P3dArraySample &iSamp )
+{
+    return ComputeBoundsFromPositions( iSamp.get(), iSamp.size() );
+}
+
+inline Abc::Box3d ComputeBoundsFromPositions( const Abc::V3dArraySample &iSamp )
+{
+    return ComputeBoundsFromPositions( iSamp.get(), iSamp.size() );
+}
+
 //-*****************************************************************************
 //! This utility function computes an axis-aligned bounding box from a
 //! positions sample
@@ -0,0 +1,568 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/AbcGeom/IBoundsIndex.h>
+#include <Alembic/AbcGeom/IGeomBase.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+const size_t IBoundsIndex::kInvalidIndex = ( size_t ) -1;
+
+namespace {
+
+// entries per leaf of the tree
+const size_t kMaxLeafEntries = 4;
+
+//-*****************************************************************************
+// transforms the 8 corners of the box without building them, only valid for
+// affine matrices
+Abc::Box3d transformBox( const Abc::Box3d & iBox, const Abc::M44d & iMat )
+{
+    if ( iBox.isEmpty() )
+    {
+        return iBox;
+    }
+
+    Abc::Box3d ret;
+    for ( size_t j = 0; j < 3; ++j )
+    {
+        ret.min[j] = iMat.x[3][j];
+        ret.max[j] = iMat.x[3][j];
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            double a = iMat.x[i][j] * iBox.min[i];
+            double b = iMat.x[i][j] * iBox.max[i];
+            ret.min[j] += std::min( a, b );
+            ret.max[j] += std::max( a, b );
+        }
+    }
+
+    return ret;
+}
+
+//-*****************************************************************************
+bool intersects( const Abc::Box3d & iA, const Abc::Box3d & iB )
+{
+    return !iA.isEmpty() && !iB.isEmpty() &&
+        iA.min.x <= iB.max.x && iA.max.x >= iB.min.x &&
+        iA.min.y <= iB.max.y && iA.max.y >= iB.min.y &&
+        iA.min.z <= iB.max.z && iA.max.z >= iB.min.z;
+}
+
+//-*****************************************************************************
+// points p with normal.dot( p ) + offset >= 0 are inside
+struct Plane
+{
+    Abc::V3d normal;
+    double offset;
+};
+
+//-*****************************************************************************
+// a box is outside if its corner furthest along the normal of any of the
+// planes is still behind it
+bool insidePlanes( const Abc::Box3d & iBox, const Plane * iPlanes )
+{
+    if ( iBox.isEmpty() )
+    {
+        return false;
+    }
+
+    for ( size_t i = 0; i < 6; ++i )
+    {
+        const Abc::V3d & n = iPlanes[i].normal;
+        double d = iPlanes[i].offset;
+        d += n.x * ( n.x > 0.0 ? iBox.max.x : iBox.min.x );
+        d += n.y * ( n.y > 0.0 ? iBox.max.y : iBox.min.y );
+        d += n.z * ( n.z > 0.0 ? iBox.max.z : iBox.min.z );
+        if ( d < 0.0 )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+struct CenterLess
+{
+    CenterLess( const std::vector< Abc::V3d > & iCenters, size_t iAxis )
+      : centers( iCenters ), axis( iAxis ) {}
+
+    bool operator()( size_t iA, size_t iB ) const
+    {
+        return centers[iA][axis] < centers[iB][axis];
+    }
+
+    const std::vector< Abc::V3d > & centers;
+    size_t axis;
+};
+
+} // End namespace
+
+//-*****************************************************************************
+IBoundsIndex::IBoundsIndex()
+  : m_worldBoundsIndex( 0 )
+  , m_evaluated( false )
+{
+}
+
+//-*****************************************************************************
+IBoundsIndex::IBoundsIndex( const Abc::IObject & iRoot )
+  : m_xforms( iRoot )
+  , m_worldBoundsIndex( 0 )
+  , m_evaluated( false )
+{
+    if ( !iRoot.valid() )
+    {
+        return;
+    }
+
+    size_t rootIndex = m_xforms.getIndex( iRoot.getFullName() );
+    if ( rootIndex == IWorldXformEvaluator::kInvalidIndex )
+    {
+        return;
+    }
+
+    // everything from the root on is under it
+    for ( size_t i = rootIndex; i < m_xforms.getNumObjects(); ++i )
+    {
+        const Abc::IObject & obj = m_xforms.getObject( i );
+
+        Entry entry;
+        if ( IGeomBase::matches( obj.getMetaData() ) )
+        {
+            entry.bounds = IGeomBaseObject( obj, kWrapExisting ).getSchema(
+                ).getSelfBoundsProperty();
+        }
+        else if ( IXform::matches( obj.getHeader() ) &&
+                  obj.getNumChildren() == 0 )
+        {
+            entry.bounds = IXform( obj ).getSchema().getChildBoundsProperty();
+        }
+
+        if ( !entry.bounds.valid() )
+        {
+            continue;
+        }
+
+        entry.fullName = obj.getFullName();
+        entry.xformIndex = i;
+        entry.sampleIndex = 0;
+
+        m_indices[entry.fullName] = m_entries.size();
+        m_entries.push_back( entry );
+    }
+}
+
+//-*****************************************************************************
+IBoundsIndex::IBoundsIndex( const Abc::ICompoundProperty & iIndexProp )
+  : m_worldBoundsIndex( 0 )
+  , m_evaluated( false )
+{
+    Abc::IStringArrayProperty namesProp( iIndexProp, ".names" );
+    m_worldBounds = Abc::IBox3dArrayProperty( iIndexProp, ".bounds" );
+
+    Abc::StringArraySamplePtr names = namesProp.getValue();
+    m_entries.resize( names->size() );
+    for ( size_t i = 0; i < names->size(); ++i )
+    {
+        Entry & entry = m_entries[i];
+        entry.fullName = ( *names )[i];
+        entry.xformIndex = IWorldXformEvaluator::kInvalidIndex;
+        entry.sampleIndex = 0;
+        m_indices[entry.fullName] = i;
+    }
+}
+
+//-*****************************************************************************
+void IBoundsIndex::evaluate( const Abc::ISampleSelector & iSS )
+{
+    bool changed = !m_evaluated;
+
+    if ( m_worldBounds.valid() )
+    {
+        index_t index = m_worldBounds.isConstant() ? 0 : iSS.getIndex(
+            m_worldBounds.getTimeSampling(), m_worldBounds.getNumSamples() );
+
+        if ( !m_evaluated || index != m_worldBoundsIndex )
+        {
+            Abc::Box3dArraySamplePtr samp = m_worldBounds.getValue(
+                Abc::ISampleSelector( index ) );
+
+            ABCA_ASSERT( samp->size() == m_entries.size(),
+                         "Bounds index has " << samp->size() <<
+                         " bounds for " << m_entries.size() << " names" );
+
+            for ( size_t i = 0; i < m_entries.size(); ++i )
+            {
+                m_entries[i].world = ( *samp )[i];
+            }
+
+            m_worldBoundsIndex = index;
+            changed = true;
+        }
+    }
+    else
+    {
+        m_xforms.evaluate( iSS );
+
+        for ( size_t i = 0; i < m_entries.size(); ++i )
+        {
+            Entry & entry = m_entries[i];
+
+            index_t index = entry.bounds.isConstant() ? 0 : iSS.getIndex(
+                entry.bounds.getTimeSampling(), entry.bounds.getNumSamples() );
+
+            bool readBounds = !m_evaluated || index != entry.sampleIndex;
+            if ( readBounds )
+            {
+                entry.local = entry.bounds.getValue(
+                    Abc::ISampleSelector( index ) );
+                entry.sampleIndex = index;
+            }
+
+            if ( readBounds || m_xforms.hasChanged( entry.xformIndex ) )
+            {
+                entry.world = transformBox( entry.local,
+                    m_xforms.getWorldMatrix( entry.xformIndex ) );
+                changed = true;
+            }
+        }
+    }
+
+    if ( !m_evaluated )
+    {
+        build();
+    }
+    else if ( changed )
+    {
+        refit();
+    }
+
+    m_evaluated = true;
+}
+
+//-*****************************************************************************
+void IBoundsIndex::build()
+{
+    m_nodes.clear();
+    m_order.resize( m_entries.size() );
+
+    std::vector< Abc::V3d > centers( m_entries.size() );
+    for ( size_t i = 0; i < m_entries.size(); ++i )
+    {
+        m_order[i] = i;
+        if ( !m_entries[i].world.isEmpty() )
+        {
+            centers[i] = m_entries[i].world.center();
+        }
+        else
+        {
+            centers[i] = Abc::V3d( 0.0, 0.0, 0.0 );
+        }
+    }
+
+    if ( m_entries.empty() )
+    {
+        return;
+    }
+
+    // the range of m_order a node covers, nodes are added when they are
+    // popped so they end up depth first with the first child right after
+    // its parent, and the second child patches its index into the parent
+    struct Range
+    {
+        size_t parent;
+        size_t first;
+        size_t last;
+    };
+
+    std::vector< Range > stack;
+    Range root = { kInvalidIndex, 0, m_entries.size() };
+    stack.push_back( root );
+
+    while ( !stack.empty() )
+    {
+        Range range = stack.back();
+        stack.pop_back();
+
+        size_t nodeIndex = m_nodes.size();
+        if ( range.parent != kInvalidIndex && range.parent + 1 != nodeIndex )
+        {
+            m_nodes[range.parent].second = nodeIndex;
+        }
+
+        Node node;
+        node.first = range.first;
+        node.second = 0;
+        node.numEntries = range.last - range.first;
+
+        Abc::Box3d centerBounds;
+        for ( size_t i = range.first; i < range.last; ++i )
+        {
+            node.bounds.extendBy( m_entries[m_order[i]].world );
+            centerBounds.extendBy( centers[m_order[i]] );
+        }
+
+        if ( node.numEntries > kMaxLeafEntries )
+        {
+            // split at the median along the widest axis of the centers
+            size_t axis = centerBounds.majorAxis();
+            size_t mid = range.first + node.numEntries / 2;
+            std::nth_element( m_order.begin() + range.first,
+                              m_order.begin() + mid,
+                              m_order.begin() + range.last,
+                              CenterLess( centers, axis ) );
+
+            node.numEntries = 0;
+
+            Range second = { nodeIndex, mid, range.last };
+            Range first = { nodeIndex, range.first, mid };
+            stack.push_back( second );
+            stack.push_back( first );
+        }
+
+        m_nodes.push_back( node );
+    }
+}
+
+//-*****************************************************************************
+void IBoundsIndex::refit()
+{
+    // children always come after their parents
+    for ( size_t i = m_nodes.size(); i > 0; --i )
+    {
+        Node & node = m_nodes[i - 1];
+        node.bounds.makeEmpty();
+
+        if ( node.numEntries > 0 )
+        {
+            for ( size_t j = 0; j < node.numEntries; ++j )
+            {
+                node.bounds.extendBy(
+                    m_entries[m_order[node.first + j]].world );
+            }
+        }
+        else
+        {
+            node.bounds.extendBy( m_nodes[i].bounds );
+            node.bounds.extendBy( m_nodes[node.second].bounds );
+        }
+    }
+}
+
+//-*****************************************************************************
+const std::string & IBoundsIndex::getFullName( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_entries.size(),
+                 "Invalid index provided to getFullName: " << iIndex );
+    return m_entries[iIndex].fullName;
+}
+
+//-*****************************************************************************
+size_t IBoundsIndex::getIndex( const std::string & iFullName ) const
+{
+    std::map< std::string, size_t >::const_iterator it =
+        m_indices.find( iFullName );
+    if ( it == m_indices.end() )
+    {
+        return kInvalidIndex;
+    }
+
+    return it->second;
+}
+
+//-*****************************************************************************
+const Abc::Box3d & IBoundsIndex::getBounds( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_entries.size(),
+                 "Invalid index provided to getBounds: " << iIndex );
+    return m_entries[iIndex].world;
+}
+
+//-*****************************************************************************
+Abc::Box3d IBoundsIndex::getTotalBounds() const
+{
+    if ( m_nodes.empty() )
+    {
+        return Abc::Box3d();
+    }
+
+    return m_nodes[0].bounds;
+}
+
+//-*****************************************************************************
+void IBoundsIndex::queryBox( const Abc::Box3d & iBox,
+                             std::vector< size_t > & oIndices ) const
+{
+    oIndices.clear();
+    if ( m_nodes.empty() )
+    {
+        return;
+    }
+
+    std::vector< size_t > stack( 1, 0 );
+    while ( !stack.empty() )
+    {
+        size_t nodeIndex = stack.back();
+        const Node & node = m_nodes[nodeIndex];
+        stack.pop_back();
+
+        if ( !intersects( node.bounds, iBox ) )
+        {
+            continue;
+        }
+
+        if ( node.numEntries == 0 )
+        {
+            stack.push_back( node.second );
+            stack.push_back( nodeIndex + 1 );
+            continue;
+        }
+
+        for ( size_t i = 0; i < node.numEntries; ++i )
+        {
+            size_t entry = m_order[node.first + i];
+            if ( intersects( m_entries[entry].world, iBox ) )
+            {
+                oIndices.push_back( entry );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void IBoundsIndex::queryFrustum( const Abc::M44d & iWorldToClip,
+                                 std::vector< size_t > & oIndices ) const
+{
+    oIndices.clear();
+    if ( m_nodes.empty() )
+    {
+        return;
+    }
+
+    // each clip space plane is the w column plus or minus one of the others
+    const Abc::M44d & m = iWorldToClip;
+    Plane planes[6];
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        planes[2 * i].normal = Abc::V3d( m.x[0][3] + m.x[0][i],
+                                         m.x[1][3] + m.x[1][i],
+                                         m.x[2][3] + m.x[2][i] );
+        planes[2 * i].offset = m.x[3][3] + m.x[3][i];
+
+        planes[2 * i + 1].normal = Abc::V3d( m.x[0][3] - m.x[0][i],
+                                             m.x[1][3] - m.x[1][i],
+                                             m.x[2][3] - m.x[2][i] );
+        planes[2 * i + 1].offset = m.x[3][3] - m.x[3][i];
+    }
+
+    std::vector< size_t > stack( 1, 0 );
+    while ( !stack.empty() )
+    {
+        size_t nodeIndex = stack.back();
+        const Node & node = m_nodes[nodeIndex];
+        stack.pop_back();
+
+        if ( !insidePlanes( node.bounds, planes ) )
+        {
+            continue;
+        }
+
+        if ( node.numEntries == 0 )
+        {
+            stack.push_back( node.second );
+            stack.push_back( nodeIndex + 1 );
+            continue;
+        }
+
+        for ( size_t i = 0; i < node.numEntries; ++i )
+        {
+            size_t entry = m_order[node.first + i];
+            if ( insidePlanes( m_entries[entry].world, planes ) )
+            {
+                oIndices.push_back( entry );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void IBoundsIndex::write( Abc::OCompoundProperty iParent,
+                          const std::vector< chrono_t > & iTimes,
+                          const std::string & iName )
+{
+    ABCA_ASSERT( !iTimes.empty(), "No times given to write the index at" );
+
+    AbcA::TimeSampling ts( AbcA::TimeSamplingType(
+        AbcA::TimeSamplingType::kAcyclic ), iTimes );
+    Alembic::Util::uint32_t tsIndex =
+        iParent.getObject().getArchive().addTimeSampling( ts );
+
+    Abc::OCompoundProperty indexProp( iParent, iName );
+
+    std::vector< std::string > names( m_entries.size() );
+    for ( size_t i = 0; i < m_entries.size(); ++i )
+    {
+        names[i] = m_entries[i].fullName;
+    }
+
+    Abc::OStringArrayProperty namesProp( indexProp, ".names" );
+    namesProp.set( names );
+
+    Abc::OBox3dArrayProperty boundsProp( indexProp, ".bounds", tsIndex );
+
+    std::vector< Abc::Box3d > bounds( m_entries.size() );
+    for ( size_t i = 0; i < iTimes.size(); ++i )
+    {
+        evaluate( Abc::ISampleSelector( iTimes[i] ) );
+        for ( size_t j = 0; j < m_entries.size(); ++j )
+        {
+            bounds[j] = m_entries[j].world;
+        }
+        boundsProp.set( bounds );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,167 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#ifndef _Alembic_AbcGeom_IBoundsIndex_h_
+#define _Alembic_AbcGeom_IBoundsIndex_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/IWorldXformEvaluator.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A bounding volume hierarchy over the world space bounds of the objects in
+//! an archive, so that only the objects touching a region or a view need to
+//! be opened.
+//!
+//! When built from an object, every object under it with .selfBnds is an
+//! entry, as is every xform with .childBnds but no children, which is how
+//! unexpanded procedurals are usually written.  Their bounds are put into
+//! world space with IWorldXformEvaluator.
+//!
+//! The world bounds can be written next to the archive bounds with write()
+//! or into a sidecar archive, and an index read back from that property
+//! only reads one array sample per evaluate instead of every object.
+//!
+//! The tree is built on the first evaluate and refit on later ones, bounds
+//! are only read again for entries whose sample or world matrix changed.
+class ALEMBIC_EXPORT IBoundsIndex
+{
+public:
+    //! Returned by getIndex for names that aren't in the index
+    static const size_t kInvalidIndex;
+
+    IBoundsIndex();
+
+    //! Indexes the bounded objects under iRoot.
+    explicit IBoundsIndex( const Abc::IObject & iRoot );
+
+    //! Reads an index that was written with write().
+    explicit IBoundsIndex( const Abc::ICompoundProperty & iIndexProp );
+
+    //! Works out the world bounds of every entry at iSS and updates the tree.
+    void evaluate( const Abc::ISampleSelector & iSS = Abc::ISampleSelector() );
+
+    size_t getNumEntries() const { return m_entries.size(); }
+
+    const std::string & getFullName( size_t iIndex ) const;
+
+    size_t getIndex( const std::string & iFullName ) const;
+
+    //! The world bounds from the last evaluate.
+    const Abc::Box3d & getBounds( size_t iIndex ) const;
+
+    //! The union of every entry's world bounds from the last evaluate.
+    Abc::Box3d getTotalBounds() const;
+
+    //! Fills oIndices with every entry whose world bounds intersect iBox.
+    void queryBox( const Abc::Box3d & iBox,
+                   std::vector< size_t > & oIndices ) const;
+
+    //! Fills oIndices with every entry whose world bounds aren't completely
+    //! outside the view frustum described by iWorldToClip, which takes row
+    //! vectors in world space to OpenGL style clip space where the visible
+    //! region is -w <= x, y, z <= w.  Entries that are only near the
+    //! corners of the frustum may be included.
+    void queryFrustum( const Abc::M44d & iWorldToClip,
+                       std::vector< size_t > & oIndices ) const;
+
+    //! Evaluates the index at each of iTimes and writes the names and world
+    //! bounds as a compound property named iName under iParent, which is
+    //! usually the top object properties of the archive itself or of a
+    //! sidecar archive.  The index is left evaluated at the last time.
+    void write( Abc::OCompoundProperty iParent,
+                const std::vector< chrono_t > & iTimes,
+                const std::string & iName = ".boundsIndex" );
+
+private:
+    void build();
+    void refit();
+
+    struct Entry
+    {
+        std::string fullName;
+
+        // the bounds in the object's own space, not valid when read back
+        // from a written index
+        Abc::IBox3dProperty bounds;
+
+        // index into m_xforms
+        size_t xformIndex;
+
+        index_t sampleIndex;
+
+        Abc::Box3d local;
+        Abc::Box3d world;
+    };
+
+    // internal nodes have their first child right after them, leaves have
+    // numEntries entries starting at m_order[ first ]
+    struct Node
+    {
+        Abc::Box3d bounds;
+        size_t first;
+        size_t second;
+        size_t numEntries;
+    };
+
+    std::vector< Entry > m_entries;
+    std::map< std::string, size_t > m_indices;
+
+    IWorldXformEvaluator m_xforms;
+
+    // only valid for indices read back from a written one
+    Abc::IBox3dArrayProperty m_worldBounds;
+    index_t m_worldBoundsIndex;
+
+    std::vector< Node > m_nodes;
+    std::vector< size_t > m_order;
+
+    bool m_evaluated;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -36,10 +36,306 @@
 
 #include <Alembic/AbcGeom/ICurves.h>
 
+#include <algorithm>
+
+#if !defined( ALEMBIC_LIB_USES_TR1 ) && __cplusplus >= 201103L
+#define ALEMBIC_ABCGEOM_PARALLEL_OFFSETS
+#include <thread>
+#endif
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// Everything needed to know how many values of a scope a curve has.
+struct CurveCounter
+{
+    GeometryScope scope;
+    CurveType type;
+    CurvePeriodicity wrap;
+    size_t step;
+    const Alembic::Util::int32_t * numVertices;
+    const Alembic::Util::uint8_t * orders;
+
+    Alembic::Util::uint64_t count( size_t iCurve ) const
+    {
+        if ( scope == kUniformScope )
+        {
+            return 1;
+        }
+
+        Alembic::Util::int32_t nv = numVertices[iCurve];
+        if ( nv <= 0 )
+        {
+            return 0;
+        }
+
+        if ( scope == kVertexScope || type == kLinear )
+        {
+            return nv;
+        }
+
+        // varying values sit at the ends of each segment
+        if ( type == kVariableOrder )
+        {
+            Alembic::Util::int32_t order = orders ? orders[iCurve] : 4;
+            if ( wrap == kPeriodic || order <= 2 )
+            {
+                return nv;
+            }
+            return std::max( nv - order + 1, 0 ) + 1;
+        }
+
+        if ( wrap == kPeriodic )
+        {
+            return nv / step;
+        }
+
+        if ( nv < 4 )
+        {
+            return nv;
+        }
+
+        return ( nv - 4 ) / step + 2;
+    }
+};
+
+//-*****************************************************************************
+void SumCounts( const CurveCounter * iCounter, size_t iStart, size_t iEnd,
+                Alembic::Util::uint64_t * oSum )
+{
+    Alembic::Util::uint64_t sum = 0;
+    for ( size_t i = iStart; i < iEnd; ++i )
+    {
+        sum += iCounter->count( i );
+    }
+    *oSum = sum;
+}
+
+//-*****************************************************************************
+// Writes oOffsets[iStart] up to, but not including, oOffsets[iEnd] and
+// returns the offset just past the last of those curves.
+Alembic::Util::uint64_t WriteOffsets( const CurveCounter * iCounter,
+                                      size_t iStart, size_t iEnd,
+                                      Alembic::Util::uint64_t iFirst,
+                                      Alembic::Util::uint64_t * oOffsets )
+{
+    Alembic::Util::uint64_t offset = iFirst;
+    for ( size_t i = iStart; i < iEnd; ++i )
+    {
+        oOffsets[i] = offset;
+        offset += iCounter->count( i );
+    }
+    return offset;
+}
+
+//-*****************************************************************************
+// Below this many curves per thread, starting the threads costs more
+// than they save.
+const size_t kMinCurvesPerThread = 256 * 1024;
+
+//-*****************************************************************************
+// How many distinct nVertices samples each CurvesOffsetsCache remembers.
+const size_t kMaxCachedOffsets = 8;
+
+//-*****************************************************************************
+int ScopeSlot( GeometryScope iScope )
+{
+    switch ( iScope )
+    {
+    case kVertexScope:
+        return 0;
+
+    case kVaryingScope:
+    case kFacevaryingScope:
+        return 1;
+
+    case kUniformScope:
+        return 2;
+
+    default:
+        return -1;
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+CurvesOffsetsCache::CurvesOffsetsCache()
+{
+}
+
+//-*****************************************************************************
+Abc::UInt64ArraySamplePtr
+CurvesOffsetsCache::getOffsets( GeometryScope iScope,
+                                const Abc::Int32ArraySamplePtr & iNumVertices,
+                                const AbcA::ArraySampleKey & iKey,
+                                bool iHasKey, CurveType iType,
+                                CurvePeriodicity iWrap, BasisType iBasis,
+                                const Abc::UcharArraySamplePtr & iOrders )
+{
+    int slot = ScopeSlot( iScope );
+
+    // orders aren't part of the key, so variable order curves aren't cached
+    if ( slot < 0 || !iNumVertices || !iHasKey || iType == kVariableOrder )
+    {
+        return computeOffsets( iScope, iNumVertices, iType, iWrap, iBasis,
+                               iOrders );
+    }
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    std::vector< Entry >::iterator it = m_entries.begin();
+    for ( ; it != m_entries.end(); ++it )
+    {
+        if ( it->key == iKey && it->type == iType && it->wrap == iWrap &&
+             it->basis == iBasis )
+        {
+            break;
+        }
+    }
+
+    if ( it == m_entries.end() )
+    {
+        // drop the least recently used entry to make room at the back
+        if ( m_entries.size() >= kMaxCachedOffsets )
+        {
+            m_entries.pop_back();
+        }
+
+        Entry entry;
+        entry.key = iKey;
+        entry.type = iType;
+        entry.wrap = iWrap;
+        entry.basis = iBasis;
+        m_entries.push_back( entry );
+        it = m_entries.end() - 1;
+    }
+
+    // move it to the front
+    std::rotate( m_entries.begin(), it, it + 1 );
+    Entry & entry = m_entries.front();
+
+    if ( !entry.offsets[slot] )
+    {
+        entry.offsets[slot] = computeOffsets( iScope, iNumVertices, iType,
+                                              iWrap, iBasis, iOrders );
+    }
+
+    return entry.offsets[slot];
+}
+
+//-*****************************************************************************
+Abc::UInt64ArraySamplePtr
+CurvesOffsetsCache::computeOffsets( GeometryScope iScope,
+    const Abc::Int32ArraySamplePtr & iNumVertices,
+    CurveType iType, CurvePeriodicity iWrap, BasisType iBasis,
+    const Abc::UcharArraySamplePtr & iOrders, size_t iNumThreads )
+{
+    if ( ScopeSlot( iScope ) < 0 || !iNumVertices )
+    {
+        return Abc::UInt64ArraySamplePtr();
+    }
+
+    size_t numCurves = iNumVertices->size();
+
+    CurveCounter counter;
+    counter.scope = iScope;
+    counter.type = iType;
+    counter.wrap = iWrap;
+    counter.step = std::max( GetStepFromBasisType( iBasis ), 1 );
+    counter.numVertices = iNumVertices->get();
+    counter.orders = NULL;
+
+    if ( iType == kVariableOrder && iOrders )
+    {
+        ABCA_ASSERT( iOrders->size() == numCurves,
+                     "Expected " << numCurves << " orders, got "
+                     << iOrders->size() );
+        counter.orders = iOrders->get();
+    }
+
+    Alembic::Util::uint64_t * offsets =
+        new Alembic::Util::uint64_t[numCurves + 1];
+
+    size_t numThreads = 1;
+
+#ifdef ALEMBIC_ABCGEOM_PARALLEL_OFFSETS
+    if ( iNumThreads == 0 )
+    {
+        numThreads = std::min( ( size_t ) std::thread::hardware_concurrency(),
+                               numCurves / kMinCurvesPerThread );
+    }
+    else
+    {
+        numThreads = std::min( iNumThreads, numCurves );
+    }
+#endif
+
+    if ( numThreads < 2 )
+    {
+        offsets[numCurves] = WriteOffsets( &counter, 0, numCurves, 0,
+                                           offsets );
+    }
+#ifdef ALEMBIC_ABCGEOM_PARALLEL_OFFSETS
+    else
+    {
+        // sum each chunk, scan the sums, then write each chunk's offsets
+        // starting from where the chunks before it end
+        std::vector< Alembic::Util::uint64_t > sums( numThreads + 1, 0 );
+        std::vector< size_t > starts( numThreads + 1, numCurves );
+        std::vector< std::thread > threads;
+
+        size_t chunk = numCurves / numThreads;
+        for ( size_t t = 0; t < numThreads; ++t )
+        {
+            starts[t] = t * chunk;
+        }
+
+        for ( size_t t = 1; t < numThreads; ++t )
+        {
+            threads.push_back( std::thread( SumCounts, &counter, starts[t],
+                starts[t + 1], &sums[t + 1] ) );
+        }
+
+        SumCounts( &counter, starts[0], starts[1], &sums[1] );
+
+        for ( size_t t = 0; t < threads.size(); ++t )
+        {
+            threads[t].join();
+        }
+        threads.clear();
+
+        for ( size_t t = 1; t <= numThreads; ++t )
+        {
+            sums[t] += sums[t - 1];
+        }
+
+        // each chunk writes only its own offsets, the total is already known
+        offsets[numCurves] = sums[numThreads];
+
+        for ( size_t t = 1; t < numThreads; ++t )
+        {
+            threads.push_back( std::thread( WriteOffsets, &counter,
+                starts[t], starts[t + 1], sums[t], offsets ) );
+        }
+
+        WriteOffsets( &counter, starts[0], starts[1], 0, offsets );
+
+        for ( size_t t = 0; t < threads.size(); ++t )
+        {
+            threads[t].join();
+        }
+    }
+#endif
+
+    return Abc::UInt64ArraySamplePtr( new Abc::UInt64ArraySample( offsets,
+        numCurves + 1 ), AbcA::TArrayDeleter< Alembic::Util::uint64_t >() );
+}
+
 //-*****************************************************************************
 MeshTopologyVariance ICurvesSchema::getTopologyVariance() const
 {
@@ -95,6 +391,8 @@ void ICurvesSchema::init( const Abc::Argument &iArg0,
     m_basisAndTypeProperty = Abc::IScalarProperty( _this, "curveBasisAndType",
         args.getErrorHandlerPolicy());
 
+    m_offsetsCache.reset( new CurvesOffsetsCache() );
+
     // none of the things below here are guaranteed to exist
     if ( this->getPropertyHeader( "w" ) != NULL )
     {
@@ -158,6 +456,10 @@ void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
     oSample.m_basis = static_cast<BasisType>( basisAndType[2] );
     // we ignore basisAndType[3] since it is the same as basisAndType[2]
 
+    oSample.m_offsetsCache = m_offsetsCache;
+    oSample.m_hasNVerticesKey =
+        m_nVerticesProperty.getKey( oSample.m_nVerticesKey, iSS );
+
     if ( m_positionWeightsProperty )
     {
         m_positionWeightsProperty.get( oSample.m_positionWeights, iSS );
@@ -186,6 +488,59 @@ void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
+                         const Abc::ISampleSelector &iSS,
+                         Abc::IArrayReadGroup &ioGroup ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ICurvesSchema::get()" );
+
+    if ( ! valid() ) { return; }
+
+    ioGroup.add( m_positionsProperty, oSample.m_positions, iSS );
+    ioGroup.add( m_nVerticesProperty, oSample.m_nVertices, iSS );
+
+    Alembic::Util::uint8_t basisAndType[4];
+    m_basisAndTypeProperty.get( basisAndType, iSS );
+
+    oSample.m_type = static_cast<CurveType>( basisAndType[0] );
+    oSample.m_wrap = static_cast<CurvePeriodicity>( basisAndType[1] );
+    oSample.m_basis = static_cast<BasisType>( basisAndType[2] );
+    // we ignore basisAndType[3] since it is the same as basisAndType[2]
+
+    oSample.m_offsetsCache = m_offsetsCache;
+    oSample.m_hasNVerticesKey =
+        m_nVerticesProperty.getKey( oSample.m_nVerticesKey, iSS );
+
+    if ( m_positionWeightsProperty )
+    {
+        ioGroup.add( m_positionWeightsProperty, oSample.m_positionWeights,
+                     iSS );
+    }
+
+    if ( m_ordersProperty )
+    {
+        ioGroup.add( m_ordersProperty, oSample.m_orders, iSS );
+    }
+
+    if ( m_knotsProperty )
+    {
+        ioGroup.add( m_knotsProperty, oSample.m_knots, iSS );
+    }
+
+    if ( m_selfBoundsProperty )
+    {
+        m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+    }
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        ioGroup.add( m_velocitiesProperty, oSample.m_velocities, iSS );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -49,6 +49,57 @@ namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! Works out the offset of each curve's first value for the values of a
+//! given GeometryScope, with the total number of values as the last element.
+//! The offsets for the last few nVertices samples seen are kept, keyed on
+//! their digests, so samples which share their curve vertex counts also
+//! share their offsets.  Each ICurvesSchema owns one of these and hands it
+//! to the samples it reads.
+class ALEMBIC_EXPORT CurvesOffsetsCache
+{
+public:
+    CurvesOffsetsCache();
+
+    //! Returns the offsets for iScope, computing them only if iKey and the
+    //! curve description aren't among the most recently used ones.  Nothing
+    //! is cached if iHasKey is false or iType is kVariableOrder.  NULL is
+    //! returned for kConstantScope and kUnknownScope.
+    Abc::UInt64ArraySamplePtr getOffsets( GeometryScope iScope,
+        const Abc::Int32ArraySamplePtr & iNumVertices,
+        const AbcA::ArraySampleKey & iKey, bool iHasKey,
+        CurveType iType, CurvePeriodicity iWrap, BasisType iBasis,
+        const Abc::UcharArraySamplePtr & iOrders );
+
+    //! Computes the offsets without touching any cache, a large number of
+    //! curves is summed with several threads.  iNumThreads of 0 picks the
+    //! number of threads from the number of curves and cores, any other
+    //! value is used as is.
+    static Abc::UInt64ArraySamplePtr computeOffsets( GeometryScope iScope,
+        const Abc::Int32ArraySamplePtr & iNumVertices,
+        CurveType iType, CurvePeriodicity iWrap, BasisType iBasis,
+        const Abc::UcharArraySamplePtr & iOrders, size_t iNumThreads = 0 );
+
+private:
+    struct Entry
+    {
+        AbcA::ArraySampleKey key;
+        CurveType type;
+        CurvePeriodicity wrap;
+        BasisType basis;
+
+        // vertex, varying and uniform offsets, computed as they are asked for
+        Abc::UInt64ArraySamplePtr offsets[3];
+    };
+
+    Alembic::Util::mutex m_lock;
+
+    // most recently used first
+    std::vector< Entry > m_entries;
+};
+
+typedef Alembic::Util::shared_ptr< CurvesOffsetsCache > CurvesOffsetsCachePtr;
+
 //-*****************************************************************************
 class ALEMBIC_EXPORT ICurvesSchema : public IGeomBaseSchema<CurvesSchemaInfo>
 {
@@ -88,6 +139,27 @@ public:
         Abc::Box3d getSelfBounds() const { return m_selfBounds; }
         Abc::V3fArraySamplePtr getVelocities() const { return m_velocities; }
 
+        //! Offsets of the first value of each curve for values with iScope,
+        //! such as widths or uvs, with the total number of values as the
+        //! last element.  kFacevaryingScope is treated as kVaryingScope and
+        //! NULL is returned for kConstantScope.  Samples read from the same
+        //! schema with the same nVertices share these offsets.
+        Abc::UInt64ArraySamplePtr getOffsets( GeometryScope iScope ) const
+        {
+            if ( m_offsetsCache )
+            {
+                return m_offsetsCache->getOffsets( iScope, m_nVertices,
+                    m_nVerticesKey, m_hasNVerticesKey, m_type, m_wrap,
+                    m_basis, m_orders );
+            }
+            return CurvesOffsetsCache::computeOffsets( iScope, m_nVertices,
+                m_type, m_wrap, m_basis, m_orders );
+        }
+
+        //! Offsets of the first position of each curve.
+        Abc::UInt64ArraySamplePtr getVertexOffsets() const
+        { return getOffsets( kVertexScope ); }
+
         bool valid() const
         {
             return m_positions.get() != 0 &&
@@ -108,6 +180,9 @@ public:
             m_knots.reset();
 
             m_selfBounds.makeEmpty();
+
+            m_offsetsCache.reset();
+            m_hasNVerticesKey = false;
         }
 
         ALEMBIC_OPERATOR_BOOL( valid() );
@@ -128,6 +203,10 @@ public:
         CurveType m_type;
         BasisType m_basis;
         CurvePeriodicity m_wrap;
+
+        CurvesOffsetsCachePtr m_offsetsCache;
+        AbcA::ArraySampleKey m_nVerticesKey;
+        bool m_hasNVerticesKey;
     };
 
     //-*************************************************************************
@@ -206,6 +285,11 @@ public:
     void get( sample_type &oSample,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Reads the scalar properties now and queues up the array properties in
+    //! ioGroup, oSample is filled in once ioGroup.read() has been called.
+    void get( sample_type &oSample, const Abc::ISampleSelector &iSS,
+              Abc::IArrayReadGroup &ioGroup ) const;
+
     sample_type getValue( const Abc::ISampleSelector &iSS =
                           Abc::ISampleSelector() ) const
     {
@@ -284,6 +368,8 @@ public:
 
         m_basisAndTypeProperty.reset();
 
+        m_offsetsCache.reset();
+
         IGeomBaseSchema<CurvesSchemaInfo>::reset();
     }
 
@@ -317,6 +403,9 @@ protected:
     Abc::IFloatArrayProperty m_positionWeightsProperty;
     Abc::IUcharArrayProperty m_ordersProperty;
     Abc::IFloatArrayProperty m_knotsProperty;
+
+    // shared by copies of this schema and the samples read from it
+    CurvesOffsetsCachePtr m_offsetsCache;
 };
 
 //-*****************************************************************************
@@ -115,6 +115,70 @@ FaceSetExclusivity IFaceSetSchema::getFaceExclusivity() const
     return kFaceSetNonExclusive;
 }
 
+//-*****************************************************************************
+namespace {
+
+// Puts the faces into the sample once the group has read them.
+struct FaceSetsFinisher : public Abc::IArrayReadGroup::Finisher
+{
+    FaceSetsFinisher( FaceSetsSample & iSample, size_t iNumFaceSets )
+      : sample( iSample ), faces( iNumFaceSets ) {}
+
+    void finish()
+    {
+        for ( size_t i = 0; i < names.size(); ++i )
+        {
+            if ( faces[i] )
+            {
+                sample.addFaceSet( names[i], faces[i]->get(),
+                                   faces[i]->size() );
+            }
+            else
+            {
+                sample.addFaceSet( names[i], NULL, 0 );
+            }
+        }
+    }
+
+    FaceSetsSample & sample;
+    std::vector< std::string > names;
+
+    // sized up front, the group holds pointers to these until it reads
+    std::vector< Abc::Int32ArraySamplePtr > faces;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void GetFaceSets( FaceSetsSample &oSamp,
+                  std::map< std::string, IFaceSet > &ioFaceSets,
+                  const Abc::IObject &iParent,
+                  const Abc::ISampleSelector &iSS,
+                  Abc::IArrayReadGroup &ioGroup )
+{
+    oSamp.reset();
+
+    Alembic::Util::shared_ptr< FaceSetsFinisher > finisher(
+        new FaceSetsFinisher( oSamp, ioFaceSets.size() ) );
+
+    std::map< std::string, IFaceSet >::iterator faceSetIter;
+    size_t i = 0;
+    for ( faceSetIter = ioFaceSets.begin(); faceSetIter != ioFaceSets.end();
+          ++faceSetIter, ++i )
+    {
+        if ( !faceSetIter->second )
+        {
+            faceSetIter->second = IFaceSet( iParent, faceSetIter->first );
+        }
+
+        finisher->names.push_back( faceSetIter->first );
+        ioGroup.add( faceSetIter->second.getSchema().getFacesProperty(),
+                     finisher->faces[i], iSS );
+    }
+
+    ioGroup.addFinisher( finisher );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
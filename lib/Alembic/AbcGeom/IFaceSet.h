@@ -240,6 +240,61 @@ typedef Abc::ISchemaObject<IFaceSetSchema> IFaceSet;
 
 typedef Util::shared_ptr< IFaceSet > IFaceSetPtr;
 
+//-*****************************************************************************
+//! The faces of every FaceSet of a mesh at one time, as filled in by
+//! IPolyMeshSchema::getFaceSets and ISubDSchema::getFaceSets.  The faces of
+//! FaceSet i are getFaces()[ getOffsets()[i] ] up to, but not including,
+//! getFaces()[ getOffsets()[i + 1] ].
+class FaceSetsSample
+{
+public:
+    FaceSetsSample() : m_offsets( 1, 0 ) {}
+
+    size_t getNumFaceSets() const { return m_names.size(); }
+
+    const std::vector< std::string > & getNames() const { return m_names; }
+
+    const std::vector< Alembic::Util::int32_t > & getFaces() const
+    { return m_faces; }
+
+    const std::vector< size_t > & getOffsets() const { return m_offsets; }
+
+    //! Adds a FaceSet to the end.
+    void addFaceSet( const std::string &iName,
+                     const Alembic::Util::int32_t *iFaces,
+                     size_t iNumFaces )
+    {
+        m_names.push_back( iName );
+        m_faces.insert( m_faces.end(), iFaces, iFaces + iNumFaces );
+        m_offsets.push_back( m_faces.size() );
+    }
+
+    void reset()
+    {
+        m_names.clear();
+        m_faces.clear();
+        m_offsets.assign( 1, 0 );
+    }
+
+private:
+    std::vector< std::string > m_names;
+    std::vector< Alembic::Util::int32_t > m_faces;
+    std::vector< size_t > m_offsets;
+};
+
+//-*****************************************************************************
+//! Shared by IPolyMeshSchema::getFaceSets and ISubDSchema::getFaceSets.
+//! Queues the faces of every FaceSet in ioFaceSets, children of iParent, at
+//! iSS in ioGroup, opening any FaceSets in ioFaceSets that haven't been
+//! opened yet.  oSamp is filled in once ioGroup.read() has been called.
+//! The caller must hold the lock guarding ioFaceSets.
+ALEMBIC_EXPORT void
+GetFaceSets( FaceSetsSample &oSamp,
+             std::map< std::string, IFaceSet > &ioFaceSets,
+             const Abc::IObject &iParent,
+             const Abc::ISampleSelector &iSS,
+             Abc::IArrayReadGroup &ioGroup );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -40,6 +40,8 @@
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/GeometryScope.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
@@ -86,6 +88,53 @@ public:
         bool m_isIndexed;
     };
 
+    //! Holds an expanded sample between calls to getExpanded so its storage
+    //! can be reused, and remembers the keys of the indices and values it
+    //! was expanded from so unchanged samples aren't expanded again.  Values
+    //! which don't need indices expanding are held as the sample that was
+    //! read, without copying them.
+    class ExpandedBuffer
+    {
+    public:
+        ExpandedBuffer()
+          : m_valsKey(), m_indicesKey(), m_hasKeys( false )
+          , m_indexed( false ) {}
+
+        const value_type * get() const
+        {
+            if ( m_sample ) { return m_sample->get(); }
+            return m_vals.empty() ? NULL : &m_vals.front();
+        }
+
+        size_t size() const
+        { return m_sample ? m_sample->size() : m_vals.size(); }
+
+        const value_type & operator[]( size_t i ) const { return get()[i]; }
+
+        void reset()
+        {
+            m_vals.clear();
+            m_sample.reset();
+            m_hasKeys = false;
+        }
+
+    protected:
+        friend class ITypedGeomParam<TRAITS>;
+
+        // the gathered values, only used when there are indices
+        std::vector< value_type > m_vals;
+
+        // the values as read, when there were no indices
+        Alembic::Util::shared_ptr< Abc::TypedArraySample<TRAITS> > m_sample;
+
+        AbcA::ArraySampleKey m_valsKey;
+        AbcA::ArraySampleKey m_indicesKey;
+        bool m_hasKeys;
+
+        // whether m_vals was gathered through an indices property
+        bool m_indexed;
+    };
+
     //-*************************************************************************
     typedef ITypedGeomParam<TRAITS> this_type;
     typedef typename this_type::Sample sample_type;
@@ -136,6 +185,13 @@ public:
     void getExpanded( sample_type &oSamp,
                       const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Expands into oBuffer, which only allocates when it needs to grow.
+    //! Returns false without reading the samples if the indices and values
+    //! at iSS are the same ones oBuffer was last expanded from.  Values
+    //! without indices aren't copied, oBuffer keeps the sample that was read.
+    bool getExpanded( ExpandedBuffer &oBuffer,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
+
     sample_type getIndexedValue( const Abc::ISampleSelector &iSS = \
                                  Abc::ISampleSelector() ) const
     {
@@ -397,6 +453,83 @@ ITypedGeomParam<TRAITS>::getExpanded( typename ITypedGeomParam<TRAITS>::Sample &
 
 }
 
+//-*****************************************************************************
+template <class TRAITS>
+bool
+ITypedGeomParam<TRAITS>::getExpanded(
+    typename ITypedGeomParam<TRAITS>::ExpandedBuffer &oBuffer,
+    const Abc::ISampleSelector &iSS ) const
+{
+    // the keys are the digests of the data, which the archive can look up
+    // without reading the samples
+    AbcA::ArraySampleKey valsKey = AbcA::ArraySampleKey();
+    AbcA::ArraySampleKey indicesKey = AbcA::ArraySampleKey();
+    bool hasKeys = m_valProp.getKey( valsKey, iSS );
+    if ( m_indicesProperty )
+    {
+        hasKeys = hasKeys && m_indicesProperty.getKey( indicesKey, iSS );
+    }
+
+    bool indexed = m_indicesProperty.valid();
+    if ( hasKeys && oBuffer.m_hasKeys && valsKey == oBuffer.m_valsKey &&
+         indexed == oBuffer.m_indexed &&
+         ( !indexed || indicesKey == oBuffer.m_indicesKey ) )
+    {
+        return false;
+    }
+
+    Alembic::Util::shared_ptr< Abc::TypedArraySample<TRAITS> > valPtr = \
+        m_valProp.getValue( iSS );
+    const value_type * vals = valPtr->get();
+    size_t numVals = valPtr->size();
+
+    Abc::UInt32ArraySamplePtr idxPtr;
+    if ( m_indicesProperty )
+    {
+        idxPtr = m_indicesProperty.getValue( iSS );
+    }
+
+    // no indices?  just hold on to the values, keeping m_vals' storage
+    // for when there are indices again
+    if ( ! idxPtr || idxPtr->size() == 0 )
+    {
+        oBuffer.m_sample = valPtr;
+        oBuffer.m_vals.clear();
+    }
+    else
+    {
+        oBuffer.m_sample.reset();
+
+        size_t size = idxPtr->size();
+        const uint32_t * indices = idxPtr->get();
+
+        // validate once up front so the gather loop stays branch free
+        uint32_t maxIndex = 0;
+        for ( size_t i = 0 ; i < size ; ++i )
+        {
+            maxIndex = std::max( maxIndex, indices[i] );
+        }
+
+        ABCA_ASSERT( maxIndex < numVals, "Index " << maxIndex <<
+                     " out of range for " << numVals << " values" );
+
+        oBuffer.m_vals.resize( size );
+        value_type * v = &( oBuffer.m_vals.front() );
+
+        for ( size_t i = 0 ; i < size ; ++i )
+        {
+            v[i] = vals[ indices[i] ];
+        }
+    }
+
+    oBuffer.m_valsKey = valsKey;
+    oBuffer.m_indicesKey = indicesKey;
+    oBuffer.m_hasKeys = hasKeys;
+    oBuffer.m_indexed = indexed;
+
+    return true;
+}
+
 //-*****************************************************************************
 template <class TRAITS>
 size_t ITypedGeomParam<TRAITS>::getNumSamples() const
@@ -188,6 +188,24 @@ public:
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Reads the bounds now and queues up the array properties in ioGroup,
+    //! oSample is filled in once ioGroup.read() has been called.
+    void get( Sample &oSample, const Abc::ISampleSelector &iSS,
+              Abc::IArrayReadGroup &ioGroup ) const
+    {
+        ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::get()" );
+
+        ioGroup.add( m_positionsProperty, oSample.m_positions, iSS );
+        ioGroup.add( m_idsProperty, oSample.m_ids, iSS );
+
+        m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+
+        if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+        { ioGroup.add( m_velocitiesProperty, oSample.m_velocities, iSS ); }
+
+        ALEMBIC_ABC_SAFE_CALL_END();
+    }
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
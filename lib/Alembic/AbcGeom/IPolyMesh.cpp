@@ -105,11 +105,71 @@ void IPolyMeshSchema::init( const Abc::Argument &iArg0,
                                                        iArg0, iArg1 );
     }
 
+    if ( m_indicesProperty.isConstant() && m_countsProperty.isConstant() )
+    {
+        m_topologyCache.reset( new TopologyCache() );
+    }
+
     m_faceSetsLoaded = false;
 
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
+//-*****************************************************************************
+bool IPolyMeshSchema::getCachedTopology( Sample &oSample, bool iRead ) const
+{
+    Alembic::Util::scoped_lock l( m_topologyCache->lock );
+
+    if ( !m_topologyCache->indices )
+    {
+        if ( !iRead )
+        {
+            return false;
+        }
+
+        // constant, so any sample will do
+        m_indicesProperty.get( m_topologyCache->indices );
+        m_countsProperty.get( m_topologyCache->counts );
+    }
+
+    oSample.m_indices = m_topologyCache->indices;
+    oSample.m_counts = m_topologyCache->counts;
+    return true;
+}
+
+//-*****************************************************************************
+struct IPolyMeshSchema::TopologyFinisher : public Abc::IArrayReadGroup::Finisher
+{
+    TopologyFinisher( Alembic::Util::shared_ptr< TopologyCache > iCache,
+                      Sample & iSample )
+      : cache( iCache ), sample( iSample ) {}
+
+    void finish()
+    {
+        Alembic::Util::scoped_lock l( cache->lock );
+
+        if ( !cache->indices )
+        {
+            cache->indices = sample.m_indices;
+            cache->counts = sample.m_counts;
+        }
+
+        sample.m_indices = cache->indices;
+        sample.m_counts = cache->counts;
+    }
+
+    Alembic::Util::shared_ptr< TopologyCache > cache;
+    Sample & sample;
+};
+
+//-*****************************************************************************
+void IPolyMeshSchema::cacheTopologyAfterRead( Sample &oSample,
+    Abc::IArrayReadGroup &ioGroup ) const
+{
+    ioGroup.addFinisher( Abc::IArrayReadGroup::FinisherPtr(
+        new TopologyFinisher( m_topologyCache, oSample ) ) );
+}
+
 //-*****************************************************************************
 const IPolyMeshSchema &
 IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
@@ -120,6 +180,7 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     m_velocitiesProperty = rhs.m_velocitiesProperty;
     m_indicesProperty   = rhs.m_indicesProperty;
     m_countsProperty    = rhs.m_countsProperty;
+    m_topologyCache     = rhs.m_topologyCache;
 
     m_uvsParam          = rhs.m_uvsParam;
     m_normalsParam      = rhs.m_normalsParam;
@@ -228,6 +289,34 @@ IPolyMeshSchema::getFaceSet ( const std::string &iFaceSetName )
     return emptyFaceSet;
 }
 
+//-*****************************************************************************
+void IPolyMeshSchema::getFaceSets( FaceSetsSample &oSamp,
+                                   const Abc::ISampleSelector &iSS,
+                                   size_t iNumThreads )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getFaceSets()" );
+
+    Abc::IArrayReadGroup group( iNumThreads );
+    getFaceSets( oSamp, iSS, group );
+    group.read();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getFaceSets( FaceSetsSample &oSamp,
+                                   const Abc::ISampleSelector &iSS,
+                                   Abc::IArrayReadGroup &ioGroup )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getFaceSets()" );
+
+    Alembic::Util::scoped_lock l(m_faceSetsMutex);
+    loadFaceSetNames();
+
+    GetFaceSets( oSamp, m_faceSets, getObject(), iSS, ioGroup );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
 
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
@@ -182,8 +182,16 @@ public:
         ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::get()" );
 
         m_positionsProperty.get( oSample.m_positions, iSS );
-        m_indicesProperty.get( oSample.m_indices, iSS );
-        m_countsProperty.get( oSample.m_counts, iSS );
+
+        if ( m_topologyCache )
+        {
+            getCachedTopology( oSample );
+        }
+        else
+        {
+            m_indicesProperty.get( oSample.m_indices, iSS );
+            m_countsProperty.get( oSample.m_counts, iSS );
+        }
 
         m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
 
@@ -197,6 +205,39 @@ public:
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Reads the bounds now and queues up the array properties in ioGroup,
+    //! oSample is filled in once ioGroup.read() has been called.  Queueing
+    //! several meshes into one group reads all of them together.
+    void get( Sample &oSample, const Abc::ISampleSelector &iSS,
+              Abc::IArrayReadGroup &ioGroup ) const
+    {
+        ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::get()" );
+
+        ioGroup.add( m_positionsProperty, oSample.m_positions, iSS );
+
+        // the topology only goes into the group the first time, and is
+        // cached once the group has read it
+        if ( !m_topologyCache || !getCachedTopology( oSample, false ) )
+        {
+            ioGroup.add( m_indicesProperty, oSample.m_indices, iSS );
+            ioGroup.add( m_countsProperty, oSample.m_counts, iSS );
+
+            if ( m_topologyCache )
+            {
+                cacheTopologyAfterRead( oSample, ioGroup );
+            }
+        }
+
+        m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+
+        if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+        {
+            ioGroup.add( m_velocitiesProperty, oSample.m_velocities, iSS );
+        }
+
+        ALEMBIC_ABC_SAFE_CALL_END();
+    }
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -248,6 +289,7 @@ public:
         m_velocitiesProperty.reset();
         m_indicesProperty.reset();
         m_countsProperty.reset();
+        m_topologyCache.reset();
 
         m_uvsParam.reset();
         m_normalsParam.reset();
@@ -271,6 +313,21 @@ public:
     IFaceSet getFaceSet( const std::string &iFaceSetName );
     bool hasFaceSet( const std::string &iFaceSetName );
 
+    //! Reads the faces of every FaceSet at iSS into oSamp with one
+    //! Abc::IArrayReadGroup, opening any FaceSets that haven't been opened
+    //! yet.  They are in the same order as getFaceSetNames.  iNumThreads is
+    //! passed to the read group, only use more than 1 for Ogawa archives
+    //! opened with that many streams.
+    void getFaceSets( FaceSetsSample &oSamp,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      size_t iNumThreads = 1 );
+
+    //! Queues the faces of every FaceSet at iSS in ioGroup, oSamp is filled
+    //! in once ioGroup.read() has been called.  Reusing one group from frame
+    //! to frame keeps its threads around.
+    void getFaceSets( FaceSetsSample &oSamp, const Abc::ISampleSelector &iSS,
+                      Abc::IArrayReadGroup &ioGroup );
+
     //! unspecified-bool-type operator overload.
     //! ...
     ALEMBIC_OVERRIDE_OPERATOR_BOOL( IPolyMeshSchema::valid() );
@@ -287,6 +344,28 @@ protected:
     IV2fGeomParam m_uvsParam;
     IN3fGeomParam m_normalsParam;
 
+    // When the face indices and counts are both constant they are only read
+    // once and every sample after that shares them.  Copies of this schema
+    // share the cache.
+    struct TopologyCache
+    {
+        Alembic::Util::mutex lock;
+        Abc::Int32ArraySamplePtr indices;
+        Abc::Int32ArraySamplePtr counts;
+    };
+
+    Alembic::Util::shared_ptr< TopologyCache > m_topologyCache;
+
+    // Puts the cached topology into oSample, reading it first if iRead is
+    // true.  Returns false if it hasn't been read.
+    bool getCachedTopology( Sample &oSample, bool iRead = true ) const;
+
+    // Once ioGroup has read the topology into oSample, it is put in the
+    // cache, or oSample is given the cached one if somebody beat it there.
+    struct TopologyFinisher;
+    void cacheTopologyAfterRead( Sample &oSample,
+                                 Abc::IArrayReadGroup &ioGroup ) const;
+
     // FaceSets, this starts as empty until client
     // code attempts to access facesets.
     bool                              m_faceSetsLoaded;
@@ -101,8 +101,13 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::get()" );
 
     m_positionsProperty.get( oSample.m_positions, iSS );
-    m_faceIndicesProperty.get( oSample.m_faceIndices, iSS );
-    m_faceCountsProperty.get( oSample.m_faceCounts, iSS );
+
+    bool cached = m_topologyCache && getCachedTopology( oSample );
+    if ( !cached )
+    {
+        m_faceIndicesProperty.get( oSample.m_faceIndices, iSS );
+        m_faceCountsProperty.get( oSample.m_faceCounts, iSS );
+    }
 
     if ( m_faceVaryingInterpolateBoundaryProperty )
     {
@@ -135,23 +140,32 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
 
     m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
 
-    if ( m_creaseIndicesProperty )
-    { m_creaseIndicesProperty.get( oSample.m_creaseIndices, iSS ); }
+    if ( !cached )
+    {
+        if ( m_creaseIndicesProperty )
+        { m_creaseIndicesProperty.get( oSample.m_creaseIndices, iSS ); }
 
-    if ( m_creaseLengthsProperty )
-    { m_creaseLengthsProperty.get( oSample.m_creaseLengths, iSS ); }
+        if ( m_creaseLengthsProperty )
+        { m_creaseLengthsProperty.get( oSample.m_creaseLengths, iSS ); }
 
-    if ( m_creaseSharpnessesProperty )
-    { m_creaseSharpnessesProperty.get( oSample.m_creaseSharpnesses, iSS ); }
+        if ( m_creaseSharpnessesProperty )
+        {
+            m_creaseSharpnessesProperty.get( oSample.m_creaseSharpnesses,
+                                             iSS );
+        }
 
-    if ( m_cornerIndicesProperty )
-    { m_cornerIndicesProperty.get( oSample.m_cornerIndices, iSS ); }
+        if ( m_cornerIndicesProperty )
+        { m_cornerIndicesProperty.get( oSample.m_cornerIndices, iSS ); }
 
-    if ( m_cornerSharpnessesProperty )
-    { m_cornerSharpnessesProperty.get( oSample.m_cornerSharpnesses, iSS ); }
+        if ( m_cornerSharpnessesProperty )
+        {
+            m_cornerSharpnessesProperty.get( oSample.m_cornerSharpnesses,
+                                             iSS );
+        }
 
-    if ( m_holesProperty )
-    { m_holesProperty.get( oSample.m_holes, iSS ); }
+        if ( m_holesProperty )
+        { m_holesProperty.get( oSample.m_holes, iSS ); }
+    }
 
     if ( m_subdSchemeProperty )
     {
@@ -168,6 +182,152 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+struct ISubDSchema::TopologyFinisher : public Abc::IArrayReadGroup::Finisher
+{
+    TopologyFinisher( Alembic::Util::shared_ptr< TopologyCache > iCache,
+                      Sample & iSample )
+      : cache( iCache ), sample( iSample ) {}
+
+    void finish()
+    {
+        Alembic::Util::scoped_lock l( cache->lock );
+
+        Sample & cached = cache->sample;
+        if ( !cache->read )
+        {
+            cached.m_faceIndices = sample.m_faceIndices;
+            cached.m_faceCounts = sample.m_faceCounts;
+            cached.m_creaseIndices = sample.m_creaseIndices;
+            cached.m_creaseLengths = sample.m_creaseLengths;
+            cached.m_creaseSharpnesses = sample.m_creaseSharpnesses;
+            cached.m_cornerIndices = sample.m_cornerIndices;
+            cached.m_cornerSharpnesses = sample.m_cornerSharpnesses;
+            cached.m_holes = sample.m_holes;
+            cache->read = true;
+            return;
+        }
+
+        sample.m_faceIndices = cached.m_faceIndices;
+        sample.m_faceCounts = cached.m_faceCounts;
+        sample.m_creaseIndices = cached.m_creaseIndices;
+        sample.m_creaseLengths = cached.m_creaseLengths;
+        sample.m_creaseSharpnesses = cached.m_creaseSharpnesses;
+        sample.m_cornerIndices = cached.m_cornerIndices;
+        sample.m_cornerSharpnesses = cached.m_cornerSharpnesses;
+        sample.m_holes = cached.m_holes;
+    }
+
+    Alembic::Util::shared_ptr< TopologyCache > cache;
+    Sample & sample;
+};
+
+//-*****************************************************************************
+void ISubDSchema::get( ISubDSchema::Sample &oSample,
+                       const Abc::ISampleSelector &iSS,
+                       Abc::IArrayReadGroup &ioGroup ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::get()" );
+
+    ioGroup.add( m_positionsProperty, oSample.m_positions, iSS );
+
+    // the topology only goes into the group the first time, and is cached
+    // once the group has read it
+    bool cached = m_topologyCache && getCachedTopology( oSample, false );
+    if ( !cached )
+    {
+        ioGroup.add( m_faceIndicesProperty, oSample.m_faceIndices, iSS );
+        ioGroup.add( m_faceCountsProperty, oSample.m_faceCounts, iSS );
+
+        if ( m_topologyCache )
+        {
+            ioGroup.addFinisher( Abc::IArrayReadGroup::FinisherPtr(
+                new TopologyFinisher( m_topologyCache, oSample ) ) );
+        }
+    }
+
+    if ( m_faceVaryingInterpolateBoundaryProperty )
+    {
+        m_faceVaryingInterpolateBoundaryProperty.get(
+            oSample.m_faceVaryingInterpolateBoundary, iSS );
+    }
+    else
+    {
+        oSample.m_faceVaryingInterpolateBoundary = 0;
+    }
+
+    if ( m_faceVaryingPropagateCornersProperty )
+    {
+        m_faceVaryingPropagateCornersProperty.get(
+            oSample.m_faceVaryingPropagateCorners, iSS );
+    }
+    else
+    {
+        oSample.m_faceVaryingPropagateCorners = 0;
+    }
+
+    if ( m_interpolateBoundaryProperty )
+    {
+        m_interpolateBoundaryProperty.get( oSample.m_interpolateBoundary, iSS );
+    }
+    else
+    {
+        oSample.m_interpolateBoundary = 0;
+    }
+
+    m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+
+    if ( !cached )
+    {
+        if ( m_creaseIndicesProperty )
+        {
+            ioGroup.add( m_creaseIndicesProperty, oSample.m_creaseIndices,
+                         iSS );
+        }
+
+        if ( m_creaseLengthsProperty )
+        {
+            ioGroup.add( m_creaseLengthsProperty, oSample.m_creaseLengths,
+                         iSS );
+        }
+
+        if ( m_creaseSharpnessesProperty )
+        {
+            ioGroup.add( m_creaseSharpnessesProperty,
+                         oSample.m_creaseSharpnesses, iSS );
+        }
+
+        if ( m_cornerIndicesProperty )
+        {
+            ioGroup.add( m_cornerIndicesProperty, oSample.m_cornerIndices,
+                         iSS );
+        }
+
+        if ( m_cornerSharpnessesProperty )
+        {
+            ioGroup.add( m_cornerSharpnessesProperty,
+                         oSample.m_cornerSharpnesses, iSS );
+        }
+
+        if ( m_holesProperty )
+        { ioGroup.add( m_holesProperty, oSample.m_holes, iSS ); }
+    }
+
+    if ( m_subdSchemeProperty )
+    {
+        m_subdSchemeProperty.get( oSample.m_subdScheme, iSS );
+    }
+    else
+    {
+        oSample.m_subdScheme = "catmull-clark";
+    }
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    { ioGroup.add( m_velocitiesProperty, oSample.m_velocities, iSS ); }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 const ISubDSchema &
 ISubDSchema::operator=(const ISubDSchema & rhs)
@@ -189,6 +349,7 @@ ISubDSchema::operator=(const ISubDSchema & rhs)
     m_cornerIndicesProperty = rhs.m_cornerIndicesProperty;
     m_cornerSharpnessesProperty = rhs.m_cornerSharpnessesProperty;
     m_holesProperty = rhs.m_holesProperty;
+    m_topologyCache = rhs.m_topologyCache;
     m_subdSchemeProperty = rhs.m_subdSchemeProperty;
     m_uvsParam = rhs.m_uvsParam;
     m_faceVaryingInterpolateBoundaryProperty =
@@ -299,11 +460,80 @@ void ISubDSchema::init( const Abc::Argument &iArg0,
                                                        iArg0, iArg1 );
     }
 
+    // everything describing the topology has to be constant for it to be
+    // cached, the ones that don't exist don't matter
+    if ( m_faceIndicesProperty.isConstant() &&
+         m_faceCountsProperty.isConstant() &&
+         ( !m_creaseIndicesProperty ||
+           m_creaseIndicesProperty.isConstant() ) &&
+         ( !m_creaseLengthsProperty ||
+           m_creaseLengthsProperty.isConstant() ) &&
+         ( !m_creaseSharpnessesProperty ||
+           m_creaseSharpnessesProperty.isConstant() ) &&
+         ( !m_cornerIndicesProperty ||
+           m_cornerIndicesProperty.isConstant() ) &&
+         ( !m_cornerSharpnessesProperty ||
+           m_cornerSharpnessesProperty.isConstant() ) &&
+         ( !m_holesProperty || m_holesProperty.isConstant() ) )
+    {
+        m_topologyCache.reset( new TopologyCache() );
+    }
+
     m_faceSetsLoaded = false;
 
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
+//-*****************************************************************************
+bool ISubDSchema::getCachedTopology( Sample &oSample, bool iRead ) const
+{
+    Alembic::Util::scoped_lock l( m_topologyCache->lock );
+
+    if ( !m_topologyCache->read )
+    {
+        if ( !iRead )
+        {
+            return false;
+        }
+
+        // constant, so any sample will do
+        Sample & samp = m_topologyCache->sample;
+        m_faceIndicesProperty.get( samp.m_faceIndices );
+        m_faceCountsProperty.get( samp.m_faceCounts );
+
+        if ( m_creaseIndicesProperty )
+        { m_creaseIndicesProperty.get( samp.m_creaseIndices ); }
+
+        if ( m_creaseLengthsProperty )
+        { m_creaseLengthsProperty.get( samp.m_creaseLengths ); }
+
+        if ( m_creaseSharpnessesProperty )
+        { m_creaseSharpnessesProperty.get( samp.m_creaseSharpnesses ); }
+
+        if ( m_cornerIndicesProperty )
+        { m_cornerIndicesProperty.get( samp.m_cornerIndices ); }
+
+        if ( m_cornerSharpnessesProperty )
+        { m_cornerSharpnessesProperty.get( samp.m_cornerSharpnesses ); }
+
+        if ( m_holesProperty )
+        { m_holesProperty.get( samp.m_holes ); }
+
+        m_topologyCache->read = true;
+    }
+
+    const Sample & samp = m_topologyCache->sample;
+    oSample.m_faceIndices = samp.m_faceIndices;
+    oSample.m_faceCounts = samp.m_faceCounts;
+    oSample.m_creaseIndices = samp.m_creaseIndices;
+    oSample.m_creaseLengths = samp.m_creaseLengths;
+    oSample.m_creaseSharpnesses = samp.m_creaseSharpnesses;
+    oSample.m_cornerIndices = samp.m_cornerIndices;
+    oSample.m_cornerSharpnesses = samp.m_cornerSharpnesses;
+    oSample.m_holes = samp.m_holes;
+    return true;
+}
+
 //-*****************************************************************************
 void ISubDSchema::getFaceSetNames (std::vector <std::string> & oFaceSetNames)
 {
@@ -399,6 +629,35 @@ ISubDSchema::getFaceSet( const std::string &iFaceSetName )
     return empty;
 }
 
+//-*****************************************************************************
+void ISubDSchema::getFaceSets( FaceSetsSample &oSamp,
+                               const Abc::ISampleSelector &iSS,
+                               size_t iNumThreads )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::getFaceSets()" );
+
+    Abc::IArrayReadGroup group( iNumThreads );
+    getFaceSets( oSamp, iSS, group );
+    group.read();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void ISubDSchema::getFaceSets( FaceSetsSample &oSamp,
+                               const Abc::ISampleSelector &iSS,
+                               Abc::IArrayReadGroup &ioGroup )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::getFaceSets()" );
+
+    Alembic::Util::scoped_lock l(m_faceSetsMutex);
+    loadFaceSetNames();
+
+    GetFaceSets( oSamp, m_faceSets, getObject(), iSS, ioGroup );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -254,6 +254,11 @@ public:
     void get( Sample &iSamp,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Reads the scalar properties now and queues up the array properties in
+    //! ioGroup, iSamp is filled in once ioGroup.read() has been called.
+    void get( Sample &iSamp, const Abc::ISampleSelector &iSS,
+              Abc::IArrayReadGroup &ioGroup ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -329,6 +334,7 @@ public:
         m_cornerSharpnessesProperty.reset();
 
         m_holesProperty.reset();
+        m_topologyCache.reset();
 
         m_subdSchemeProperty.reset();
 
@@ -353,6 +359,21 @@ public:
     IFaceSet getFaceSet( const std::string &iFaceSetName );
     bool hasFaceSet( const std::string &iFaceSetName );
 
+    //! Reads the faces of every FaceSet at iSS into oSamp with one
+    //! Abc::IArrayReadGroup, opening any FaceSets that haven't been opened
+    //! yet.  They are in the same order as getFaceSetNames.  iNumThreads is
+    //! passed to the read group, only use more than 1 for Ogawa archives
+    //! opened with that many streams.
+    void getFaceSets( FaceSetsSample &oSamp,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      size_t iNumThreads = 1 );
+
+    //! Queues the faces of every FaceSet at iSS in ioGroup, oSamp is filled
+    //! in once ioGroup.read() has been called.  Reusing one group from frame
+    //! to frame keeps its threads around.
+    void getFaceSets( FaceSetsSample &oSamp, const Abc::ISampleSelector &iSS,
+                      Abc::IArrayReadGroup &ioGroup );
+
     //! unspecified-bool-type operator overload.
     //! ...
     ALEMBIC_OVERRIDE_OPERATOR_BOOL( ISubDSchema::valid() );
@@ -397,6 +418,28 @@ protected:
 
     IV3fArrayProperty m_velocitiesProperty;
 
+    // When the face indices, counts, creases, corners and holes are all
+    // constant they are only read once and every sample after that shares
+    // them.  Copies of this schema share the cache.
+    struct TopologyCache
+    {
+        TopologyCache() : read( false ) {}
+
+        Alembic::Util::mutex lock;
+        bool read;
+        Sample sample;
+    };
+
+    Alembic::Util::shared_ptr< TopologyCache > m_topologyCache;
+
+    // Puts the cached topology into oSample, reading it first if iRead is
+    // true.  Returns false if it hasn't been read.
+    bool getCachedTopology( Sample &oSample, bool iRead = true ) const;
+
+    // Once a group has read the topology into a sample, it is put in the
+    // cache, or the sample is given the cached one if somebody beat it there.
+    struct TopologyFinisher;
+
     // FaceSets, this starts as empty until client
     // code attempts to access facesets.
     bool                              m_faceSetsLoaded;
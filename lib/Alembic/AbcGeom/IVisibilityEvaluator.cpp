@@ -0,0 +1,232 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/AbcGeom/IVisibilityEvaluator.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+const size_t IVisibilityEvaluator::kInvalidIndex = ( size_t ) -1;
+
+//-*****************************************************************************
+IVisibilityEvaluator::IVisibilityEvaluator()
+  : m_evaluated( false )
+{
+}
+
+//-*****************************************************************************
+IVisibilityEvaluator::IVisibilityEvaluator( const Abc::IObject & iRoot )
+  : m_evaluated( false )
+{
+    if ( !iRoot.valid() )
+    {
+        return;
+    }
+
+    // the objects above the root, only the chain of parents is needed
+    std::vector< Abc::IObject > above;
+    for ( Abc::IObject obj = iRoot.getParent(); obj.valid();
+          obj = obj.getParent() )
+    {
+        above.push_back( obj );
+    }
+
+    size_t parent = kInvalidIndex;
+    for ( size_t i = above.size(); i > 0; --i )
+    {
+        addObject( above[i - 1], parent );
+        parent = m_nodes.size() - 1;
+    }
+
+    // then everything under the root, depth first so parents come first
+    std::vector< std::pair< Abc::IObject, size_t > > stack;
+    stack.push_back( std::make_pair( iRoot, parent ) );
+    while ( !stack.empty() )
+    {
+        Abc::IObject obj = stack.back().first;
+        addObject( obj, stack.back().second );
+        stack.pop_back();
+
+        size_t index = m_nodes.size() - 1;
+        for ( size_t i = obj.getNumChildren(); i > 0; --i )
+        {
+            stack.push_back( std::make_pair( obj.getChild( i - 1 ), index ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+void IVisibilityEvaluator::addObject( const Abc::IObject & iObject,
+                                      size_t iParent )
+{
+    Node node;
+    node.object = iObject;
+    node.visibility = GetVisibilityProperty( node.object );
+    node.parent = iParent;
+    node.sampleIndex = 0;
+    node.value = kVisibilityDeferred;
+    node.hidden = false;
+    node.changed = false;
+
+    // a constant hidden or visible object doesn't depend on its parents
+    node.constant = !node.visibility.valid() ||
+        node.visibility.isConstant();
+    if ( node.constant && node.visibility.valid() &&
+         node.visibility.getNumSamples() > 0 )
+    {
+        node.value = ObjectVisibility( node.visibility.getValue(
+            Abc::ISampleSelector( index_t( 0 ) ) ) );
+    }
+
+    if ( node.value == kVisibilityDeferred && iParent != kInvalidIndex )
+    {
+        node.constant = node.constant && m_nodes[iParent].constant;
+    }
+
+    m_indices[iObject.getFullName()] = m_nodes.size();
+    m_nodes.push_back( node );
+}
+
+//-*****************************************************************************
+void IVisibilityEvaluator::evaluate( const Abc::ISampleSelector & iSS )
+{
+    for ( size_t i = 0; i < m_nodes.size(); ++i )
+    {
+        Node & node = m_nodes[i];
+        if ( m_evaluated && node.constant )
+        {
+            node.changed = false;
+            continue;
+        }
+
+        // constant deferred objects can still follow an animated parent
+        if ( node.visibility.valid() && !node.visibility.isConstant() )
+        {
+            index_t index = iSS.getIndex( node.visibility.getTimeSampling(),
+                                          node.visibility.getNumSamples() );
+
+            if ( !m_evaluated || index != node.sampleIndex )
+            {
+                node.value = ObjectVisibility(
+                    node.visibility.getValue( Abc::ISampleSelector( index ) ) );
+                node.sampleIndex = index;
+            }
+        }
+
+        bool hidden = false;
+        if ( node.value != kVisibilityDeferred )
+        {
+            hidden = ( node.value == kVisibilityHidden );
+        }
+        else if ( node.parent != kInvalidIndex )
+        {
+            hidden = m_nodes[node.parent].hidden;
+        }
+
+        node.changed = !m_evaluated || hidden != node.hidden;
+        node.hidden = hidden;
+    }
+
+    m_evaluated = true;
+}
+
+//-*****************************************************************************
+const Abc::IObject & IVisibilityEvaluator::getObject( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_nodes.size(),
+                 "Invalid index provided to getObject: " << iIndex );
+    return m_nodes[iIndex].object;
+}
+
+//-*****************************************************************************
+size_t IVisibilityEvaluator::getIndex( const std::string & iFullName ) const
+{
+    std::map< std::string, size_t >::const_iterator it =
+        m_indices.find( iFullName );
+    if ( it == m_indices.end() )
+    {
+        return kInvalidIndex;
+    }
+
+    return it->second;
+}
+
+//-*****************************************************************************
+ObjectVisibility IVisibilityEvaluator::getVisibility( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_nodes.size(),
+                 "Invalid index provided to getVisibility: " << iIndex );
+    return m_nodes[iIndex].value;
+}
+
+//-*****************************************************************************
+bool IVisibilityEvaluator::isHidden( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_nodes.size(),
+                 "Invalid index provided to isHidden: " << iIndex );
+    return m_nodes[iIndex].hidden;
+}
+
+//-*****************************************************************************
+bool IVisibilityEvaluator::isHidden( const std::string & iFullName ) const
+{
+    size_t index = getIndex( iFullName );
+    ABCA_ASSERT( index != kInvalidIndex,
+                 "Object not found by isHidden: " << iFullName );
+    return m_nodes[index].hidden;
+}
+
+//-*****************************************************************************
+bool IVisibilityEvaluator::hasChanged( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_nodes.size(),
+                 "Invalid index provided to hasChanged: " << iIndex );
+    return m_nodes[iIndex].changed;
+}
+
+//-*****************************************************************************
+bool IVisibilityEvaluator::isConstant( size_t iIndex ) const
+{
+    ABCA_ASSERT( iIndex < m_nodes.size(),
+                 "Invalid index provided to isConstant: " << iIndex );
+    return m_nodes[iIndex].constant;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
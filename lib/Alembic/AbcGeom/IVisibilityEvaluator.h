@@ -0,0 +1,135 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#ifndef _Alembic_AbcGeom_IVisibilityEvaluator_h_
+#define _Alembic_AbcGeom_IVisibilityEvaluator_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/Visibility.h>
+
+#include <map>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Resolves the visibility of every object under a root in one pass from the
+//! top down, giving the same answers as IsAncestorInvisible without walking
+//! up from every object.  Objects that are deferred, or have no visibility
+//! property, take the resolved visibility of their parent, and the top of
+//! the archive is visible.
+//!
+//! The hierarchy is walked and the visibility properties are looked up once
+//! when this is constructed.  Between calls to evaluate, a property is only
+//! read again if the sample it needs changed, and objects whose visibility
+//! can never change are skipped entirely.
+class ALEMBIC_EXPORT IVisibilityEvaluator
+{
+public:
+    //! Returned by getIndex for names that aren't under the root
+    static const size_t kInvalidIndex;
+
+    IVisibilityEvaluator();
+
+    explicit IVisibilityEvaluator( const Abc::IObject & iRoot );
+
+    //! Works out the visibility of everything at iSS.
+    void evaluate( const Abc::ISampleSelector & iSS = Abc::ISampleSelector() );
+
+    //! The number of objects, including the ones above the root.  Parents
+    //! always come before their children.
+    size_t getNumObjects() const { return m_nodes.size(); }
+
+    const Abc::IObject & getObject( size_t iIndex ) const;
+
+    size_t getIndex( const std::string & iFullName ) const;
+
+    //! The value of the object's own visibility property from the last
+    //! evaluate, kVisibilityDeferred if it doesn't have one.
+    ObjectVisibility getVisibility( size_t iIndex ) const;
+
+    //! Whether the object or the ancestor it defers to is hidden, the same
+    //! as IsAncestorInvisible, from the last evaluate.
+    bool isHidden( size_t iIndex ) const;
+
+    bool isHidden( const std::string & iFullName ) const;
+
+    //! Whether isHidden changed in the last evaluate.  Everything has
+    //! changed after the first one.
+    bool hasChanged( size_t iIndex ) const;
+
+    //! Whether isHidden is the same at every time.
+    bool isConstant( size_t iIndex ) const;
+
+private:
+    void addObject( const Abc::IObject & iObject, size_t iParent );
+
+    struct Node
+    {
+        Abc::IObject object;
+
+        // not valid for objects without a visibility property
+        IVisibilityProperty visibility;
+
+        size_t parent;
+
+        // the sample the visibility came from
+        index_t sampleIndex;
+
+        ObjectVisibility value;
+
+        bool hidden;
+        bool constant;
+        bool changed;
+    };
+
+    std::vector< Node > m_nodes;
+    std::map< std::string, size_t > m_indices;
+
+    bool m_evaluated;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,133 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_AbcGeom_IWorldXformEvaluator_h_
+#define _Alembic_AbcGeom_IWorldXformEvaluator_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/IXform.h>
+
+#include <map>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Computes the world matrix of every object under a root in one pass from
+//! the top down, so parents shared by many objects are only evaluated once.
+//! Objects that aren't xforms have the world matrix of their parent, and
+//! xforms that don't inherit have their local matrix as their world matrix.
+//! The world matrices include the xforms above the root.
+//!
+//! The hierarchy is walked once when this is constructed.  Between calls to
+//! evaluate, an xform is only read again if the sample it needs changed,
+//! and objects whose world matrix can never change are skipped entirely.
+class ALEMBIC_EXPORT IWorldXformEvaluator
+{
+public:
+    //! Returned by getIndex for names that aren't under the root
+    static const size_t kInvalidIndex;
+
+    IWorldXformEvaluator();
+
+    explicit IWorldXformEvaluator( const Abc::IObject & iRoot );
+
+    //! Works out the world matrices of everything at iSS.
+    void evaluate( const Abc::ISampleSelector & iSS = Abc::ISampleSelector() );
+
+    //! The number of objects, including the ones above the root.  Parents
+    //! always come before their children.
+    size_t getNumObjects() const { return m_nodes.size(); }
+
+    const Abc::IObject & getObject( size_t iIndex ) const;
+
+    size_t getIndex( const std::string & iFullName ) const;
+
+    //! The world matrix from the last evaluate.
+    const Abc::M44d & getWorldMatrix( size_t iIndex ) const;
+
+    const Abc::M44d & getWorldMatrix( const std::string & iFullName ) const;
+
+    //! The local matrix of an xform from the last evaluate, identity for
+    //! everything else.
+    const Abc::M44d & getLocalMatrix( size_t iIndex ) const;
+
+    //! Whether the world matrix changed in the last evaluate.  Everything
+    //! has changed after the first one.
+    bool hasChanged( size_t iIndex ) const;
+
+    //! Whether the world matrix is the same at every time.
+    bool isConstant( size_t iIndex ) const;
+
+private:
+    void addObject( const Abc::IObject & iObject, size_t iParent );
+
+    struct Node
+    {
+        Abc::IObject object;
+
+        // not valid for anything that isn't an xform
+        IXformSchema xform;
+
+        size_t parent;
+
+        // the xform sample the local matrix came from
+        index_t sampleIndex;
+
+        bool inherits;
+        bool constant;
+        bool changed;
+
+        Abc::M44d local;
+        Abc::M44d world;
+    };
+
+    std::vector< Node > m_nodes;
+    std::map< std::string, size_t > m_indices;
+
+    bool m_evaluated;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -315,6 +315,140 @@ XformSample IXformSchema::getValue( const Abc::ISampleSelector &iSS ) const
     return ret;
 }
 
+//-*****************************************************************************
+Abc::M44d IXformSchema::getMatrix( const Abc::ISampleSelector &iSS ) const
+{
+    Abc::M44d ret;
+    this->fillMatrices( &iSS, 1, &ret );
+    return ret;
+}
+
+//-*****************************************************************************
+void IXformSchema::getMatrices(
+    const std::vector< Abc::ISampleSelector > &iSS,
+    std::vector< Abc::M44d > &oMatrices ) const
+{
+    oMatrices.resize( iSS.size() );
+    if ( iSS.empty() ) { return; }
+
+    this->fillMatrices( &iSS.front(), iSS.size(), &oMatrices.front() );
+}
+
+//-*****************************************************************************
+void IXformSchema::fillMatrices( const Abc::ISampleSelector * iSS,
+                                 std::size_t iNumMatrices,
+                                 Abc::M44d * oMatrices ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IXformSchema::fillMatrices()" );
+
+    for ( std::size_t i = 0; i < iNumMatrices; ++i )
+    {
+        oMatrices[i].makeIdentity();
+    }
+
+    const std::vector< XformOp > & ops = m_sample.m_ops;
+    if ( ! valid() || ops.empty() ) { return; }
+
+    std::size_t numChannels = 0;
+    for ( std::size_t i = 0; i < ops.size(); ++i )
+    {
+        numChannels += ops[i].getNumChannels();
+    }
+
+    // channel major, channels[c * iNumMatrices + i] is channel c of matrix i
+    std::vector< Alembic::Util::float64_t > channels(
+        numChannels * iNumMatrices );
+
+    AbcA::index_t numSamples = 0;
+    if ( m_valsProperty && m_useArrayProp )
+    {
+        numSamples = m_valsProperty->asArrayPtr()->getNumSamples();
+    }
+    else if ( m_valsProperty )
+    {
+        numSamples = m_valsProperty->asScalarPtr()->getNumSamples();
+    }
+
+    std::vector< Alembic::Util::float64_t > scalarVals;
+    if ( numSamples > 0 && ! m_useArrayProp )
+    {
+        scalarVals.resize(
+            m_valsProperty->asScalarPtr()->getDataType().getExtent() );
+    }
+
+    AbcA::index_t lastIdx = -1;
+    for ( std::size_t i = 0; i < iNumMatrices; ++i )
+    {
+        AbcA::index_t sampIdx = -1;
+        if ( numSamples > 0 )
+        {
+            sampIdx = iSS[i].getIndex( m_valsProperty->getTimeSampling(),
+                                       numSamples );
+        }
+
+        // same sample as the previous matrix, no need to read it again
+        if ( i > 0 && sampIdx == lastIdx )
+        {
+            for ( std::size_t c = 0; c < numChannels; ++c )
+            {
+                channels[c * iNumMatrices + i] =
+                    channels[c * iNumMatrices + i - 1];
+            }
+            continue;
+        }
+
+        lastIdx = sampIdx;
+
+        const Alembic::Util::float64_t * vals = NULL;
+        std::size_t numVals = 0;
+        AbcA::ArraySamplePtr sptr;
+
+        if ( sampIdx >= 0 && m_useArrayProp )
+        {
+            m_valsProperty->asArrayPtr()->getSample( sampIdx, sptr );
+            vals = static_cast< const Alembic::Util::float64_t * >(
+                sptr->getData() );
+            numVals = sptr->size();
+        }
+        else if ( sampIdx >= 0 && ! scalarVals.empty() )
+        {
+            m_valsProperty->asScalarPtr()->getSample( sampIdx,
+                &( scalarVals.front() ) );
+            vals = &( scalarVals.front() );
+            numVals = scalarVals.size();
+        }
+
+        // channels that weren't written keep the default op values, the
+        // same as get() would leave them
+        std::size_t chanPos = 0;
+        for ( std::size_t j = 0; j < ops.size(); ++j )
+        {
+            for ( std::size_t k = 0; k < ops[j].getNumChannels();
+                  ++k, ++chanPos )
+            {
+                channels[chanPos * iNumMatrices + i] = chanPos < numVals ?
+                    vals[chanPos] : ops[j].getChannelValue( k );
+            }
+        }
+    }
+
+    const Alembic::Util::float64_t * opChannels[16];
+    std::size_t chanPos = 0;
+    for ( std::size_t j = 0; j < ops.size(); ++j )
+    {
+        std::size_t opNumChannels = ops[j].getNumChannels();
+        for ( std::size_t k = 0; k < opNumChannels; ++k, ++chanPos )
+        {
+            opChannels[k] = &( channels[chanPos * iNumMatrices] );
+        }
+
+        XformSample::applyOp( ops[j].getType(), opChannels, iNumMatrices,
+                              oMatrices, j == 0 );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 bool IXformSchema::getInheritsXforms( const Abc::ISampleSelector &iSS ) const
 {
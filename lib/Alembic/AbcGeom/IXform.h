@@ -138,6 +138,19 @@ public:
 
     size_t getNumOps() const { return m_sample.getNumOps(); }
 
+    //! Computes the same matrix as getValue( iSS ).getMatrix() but reads
+    //! the channel values straight into the op kernels instead of building
+    //! an XformSample.
+    Abc::M44d getMatrix( const Abc::ISampleSelector &iSS =
+                         Abc::ISampleSelector() ) const;
+
+    //! Computes the matrix for every sample selector in iSS.  The channels
+    //! for all of the samples are gathered first and each op is then
+    //! applied across all of the matrices at once.  Consecutive selectors
+    //! that resolve to the same sample index only read it once.
+    void getMatrices( const std::vector< Abc::ISampleSelector > &iSS,
+                      std::vector< Abc::M44d > &oMatrices ) const;
+
     //! Reset returns this function set to an empty, default
     //! state.
     void reset()
@@ -194,6 +207,11 @@ private:
     // fills m_valVec with data
     void getChannelValues( const AbcA::index_t iSampleIndex,
                            XformSample & oSamp ) const;
+
+    // shared by getMatrix and getMatrices
+    void fillMatrices( const Abc::ISampleSelector * iSS,
+                       std::size_t iNumMatrices,
+                       Abc::M44d * oMatrices ) const;
 };
 
 //-*****************************************************************************
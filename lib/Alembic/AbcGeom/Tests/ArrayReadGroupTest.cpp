@@ -0,0 +1,320 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+template <class SAMPLE_PTR>
+bool sameData( const SAMPLE_PTR & iA, const SAMPLE_PTR & iB )
+{
+    if ( !iA || !iB )
+    {
+        return !iA && !iB;
+    }
+
+    return iA->size() == iB->size() && ( iA->size() == 0 ||
+        memcmp( iA->getData(), iB->getData(),
+                iA->size() * sizeof( typename SAMPLE_PTR::element_type::
+                                     value_type ) ) == 0 );
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName, size_t iNumObjects )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject top = archive.getTop();
+
+    std::vector< V3f > verts;
+    std::vector< int32_t > indices;
+    std::vector< int32_t > counts;
+    std::vector< Alembic::Util::uint64_t > ids;
+    std::vector< float32_t > sharpness;
+
+    for ( size_t i = 0; i < iNumObjects; ++i )
+    {
+        // each object gets different amounts of data
+        size_t numQuads = 10 + i * 7;
+        verts.clear();
+        indices.clear();
+        counts.clear();
+        ids.clear();
+        sharpness.clear();
+        for ( size_t q = 0; q < numQuads; ++q )
+        {
+            for ( size_t v = 0; v < 4; ++v )
+            {
+                indices.push_back( ( int32_t ) verts.size() );
+                ids.push_back( verts.size() * 3 + i );
+                verts.push_back( V3f( q + i, ( float ) v, q * 0.5f ) );
+            }
+            counts.push_back( 4 );
+            sharpness.push_back( q * 0.25f );
+        }
+
+        std::ostringstream name;
+        name << i;
+
+        V3fArraySample vertsSamp( verts );
+        Int32ArraySample indicesSamp( indices );
+        Int32ArraySample countsSamp( counts );
+        UInt64ArraySample idsSamp( ids );
+        FloatArraySample sharpnessSamp( sharpness );
+
+        OPolyMesh mesh( top, "mesh" + name.str() );
+        OPolyMeshSchema::Sample meshSamp( vertsSamp, indicesSamp, countsSamp );
+        meshSamp.setVelocities( vertsSamp );
+        mesh.getSchema().set( meshSamp );
+
+        // never given a sample
+        OInt32ArrayProperty unset( mesh.getSchema().getArbGeomParams(),
+                                   "unset" );
+
+        OSubD subd( top, "subd" + name.str() );
+        OSubDSchema::Sample subdSamp( vertsSamp, indicesSamp, countsSamp,
+                                      indicesSamp, countsSamp,
+                                      sharpnessSamp );
+        subdSamp.setHoles( countsSamp );
+        subdSamp.setInterpolateBoundary( 1 );
+        subd.getSchema().set( subdSamp );
+
+        OCurves curves( top, "curves" + name.str() );
+        OCurvesSchema::Sample curvesSamp(
+            vertsSamp, countsSamp, kCubic,
+            kNonPeriodic, OFloatGeomParam::Sample(), OV2fGeomParam::Sample(),
+            ON3fGeomParam::Sample(), kBsplineBasis,
+            sharpnessSamp );
+        curves.getSchema().set( curvesSamp );
+
+        OPoints points( top, "points" + name.str() );
+        OPointsSchema::Sample pointsSamp( vertsSamp, idsSamp );
+        points.getSchema().set( pointsSamp );
+    }
+}
+
+//-*****************************************************************************
+void readTest()
+{
+    std::string archiveName = "arrayReadGroup.abc";
+    const size_t numObjects = 8;
+    writeArchive( archiveName, numObjects );
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive( 4 ), archiveName );
+    IObject top = archive.getTop();
+
+    for ( size_t numThreads = 1; numThreads < 8; numThreads += 3 )
+    {
+        IArrayReadGroup group( numThreads );
+        TESTING_ASSERT( group.getNumThreads() == numThreads );
+
+        // everything is read together in one group
+        std::vector< IPolyMeshSchema::Sample > meshSamps( numObjects );
+        std::vector< ISubDSchema::Sample > subdSamps( numObjects );
+        std::vector< ICurvesSchema::Sample > curvesSamps( numObjects );
+        std::vector< IPointsSchema::Sample > pointsSamps( numObjects );
+
+        std::vector< IPolyMesh > meshes;
+        std::vector< ISubD > subds;
+        std::vector< ICurves > curves;
+        std::vector< IPoints > points;
+        for ( size_t i = 0; i < numObjects; ++i )
+        {
+            std::ostringstream name;
+            name << i;
+            meshes.push_back( IPolyMesh( top, "mesh" + name.str() ) );
+            subds.push_back( ISubD( top, "subd" + name.str() ) );
+            curves.push_back( ICurves( top, "curves" + name.str() ) );
+            points.push_back( IPoints( top, "points" + name.str() ) );
+
+            meshes[i].getSchema().get( meshSamps[i], ISampleSelector(),
+                                       group );
+            subds[i].getSchema().get( subdSamps[i], ISampleSelector(), group );
+            curves[i].getSchema().get( curvesSamps[i], ISampleSelector(),
+                                       group );
+            points[i].getSchema().get( pointsSamps[i], ISampleSelector(),
+                                       group );
+        }
+
+        // mesh: P, indices, counts, velocities
+        // subd: P, indices, counts, crease indices, lengths, sharpnesses,
+        //       holes
+        // curves: P, nVertices, weights
+        // points: P, ids
+        TESTING_ASSERT( group.getNumReads() == numObjects * 16 );
+        TESTING_ASSERT( !meshSamps[0].getPositions() );
+
+        // the scalars are already there
+        TESTING_ASSERT( subdSamps[0].getInterpolateBoundary() == 1 );
+        TESTING_ASSERT( curvesSamps[0].getBasis() == kBsplineBasis );
+        TESTING_ASSERT( !meshSamps[0].getSelfBounds().isEmpty() );
+
+        group.read();
+        TESTING_ASSERT( group.getNumReads() == 0 );
+
+        for ( size_t i = 0; i < numObjects; ++i )
+        {
+            IPolyMeshSchema::Sample mesh;
+            meshes[i].getSchema().get( mesh );
+            TESTING_ASSERT( mesh.getPositions()->size() == 40 + i * 28 );
+            TESTING_ASSERT( sameData( mesh.getPositions(),
+                                      meshSamps[i].getPositions() ) );
+            TESTING_ASSERT( sameData( mesh.getFaceIndices(),
+                                      meshSamps[i].getFaceIndices() ) );
+            TESTING_ASSERT( sameData( mesh.getFaceCounts(),
+                                      meshSamps[i].getFaceCounts() ) );
+            TESTING_ASSERT( sameData( mesh.getVelocities(),
+                                      meshSamps[i].getVelocities() ) );
+            TESTING_ASSERT( mesh.getSelfBounds() ==
+                            meshSamps[i].getSelfBounds() );
+
+            ISubDSchema::Sample subd;
+            subds[i].getSchema().get( subd );
+            TESTING_ASSERT( sameData( subd.getPositions(),
+                                      subdSamps[i].getPositions() ) );
+            TESTING_ASSERT( sameData( subd.getFaceIndices(),
+                                      subdSamps[i].getFaceIndices() ) );
+            TESTING_ASSERT( sameData( subd.getFaceCounts(),
+                                      subdSamps[i].getFaceCounts() ) );
+            TESTING_ASSERT( sameData( subd.getCreaseIndices(),
+                                      subdSamps[i].getCreaseIndices() ) );
+            TESTING_ASSERT( sameData( subd.getCreaseLengths(),
+                                      subdSamps[i].getCreaseLengths() ) );
+            TESTING_ASSERT( sameData( subd.getCreaseSharpnesses(),
+                                      subdSamps[i].getCreaseSharpnesses() ) );
+            TESTING_ASSERT( sameData( subd.getHoles(),
+                                      subdSamps[i].getHoles() ) );
+            TESTING_ASSERT( sameData( subd.getCornerIndices(),
+                                      subdSamps[i].getCornerIndices() ) );
+            TESTING_ASSERT( subd.getSubdivisionScheme() ==
+                            subdSamps[i].getSubdivisionScheme() );
+
+            ICurvesSchema::Sample curve;
+            curves[i].getSchema().get( curve );
+            TESTING_ASSERT( sameData( curve.getPositions(),
+                                      curvesSamps[i].getPositions() ) );
+            TESTING_ASSERT( sameData( curve.getCurvesNumVertices(),
+                curvesSamps[i].getCurvesNumVertices() ) );
+            TESTING_ASSERT( sameData( curve.getPositionWeights(),
+                                      curvesSamps[i].getPositionWeights() ) );
+            TESTING_ASSERT( curve.getType() == curvesSamps[i].getType() );
+
+            IPointsSchema::Sample point;
+            points[i].getSchema().get( point );
+            TESTING_ASSERT( sameData( point.getPositions(),
+                                      pointsSamps[i].getPositions() ) );
+            TESTING_ASSERT( sameData( point.getIds(),
+                                      pointsSamps[i].getIds() ) );
+        }
+
+        // the group and its threads can be used again, as every frame would
+        for ( size_t frame = 0; frame < 3; ++frame )
+        {
+            std::vector< IPolyMeshSchema::Sample > again( numObjects );
+            for ( size_t i = 0; i < numObjects; ++i )
+            {
+                meshes[i].getSchema().get( again[i], ISampleSelector(),
+                                           group );
+            }
+            group.read();
+
+            for ( size_t i = 0; i < numObjects; ++i )
+            {
+                TESTING_ASSERT( sameData( again[i].getPositions(),
+                                          meshSamps[i].getPositions() ) );
+            }
+        }
+    }
+
+    // even a single mesh's reads are spread over the threads, unless the
+    // minimum is raised above how many it queues
+    {
+        IPolyMesh mesh( top, "mesh5" );
+        IPolyMeshSchema::Sample expected;
+        mesh.getSchema().get( expected );
+
+        IArrayReadGroup group( 4 );
+        TESTING_ASSERT( group.getMinParallelReads() == 2 );
+        for ( size_t minReads = 2; minReads <= 8; minReads += 6 )
+        {
+            group.setMinParallelReads( minReads );
+            TESTING_ASSERT( group.getMinParallelReads() == minReads );
+
+            IPolyMeshSchema::Sample samp;
+            mesh.getSchema().get( samp, ISampleSelector(), group );
+            // the topology was cached by the first get, P and velocities
+            TESTING_ASSERT( group.getNumReads() == 2 );
+            group.read();
+            TESTING_ASSERT( sameData( samp.getPositions(),
+                                      expected.getPositions() ) );
+            TESTING_ASSERT( sameData( samp.getFaceIndices(),
+                                      expected.getFaceIndices() ) );
+            TESTING_ASSERT( sameData( samp.getVelocities(),
+                                      expected.getVelocities() ) );
+        }
+    }
+
+    // untyped reads, invalid properties and ones with no samples are
+    // skipped
+    IPolyMesh mesh( top, "mesh3" );
+    AbcA::ArraySamplePtr untyped;
+    P3fArraySamplePtr typed;
+    Int32ArraySamplePtr unset;
+    IArrayReadGroup group( 4 );
+    group.add( mesh.getSchema().getPositionsProperty(), untyped );
+    group.add( IArrayProperty(), untyped );
+    IInt32ArrayProperty unsetProp( mesh.getSchema().getArbGeomParams(),
+                                   "unset" );
+    TESTING_ASSERT( unsetProp.valid() && unsetProp.getNumSamples() == 0 );
+    group.add( unsetProp, unset );
+    TESTING_ASSERT( group.getNumReads() == 1 );
+    group.add( mesh.getSchema().getPositionsProperty(), typed );
+    group.read();
+    TESTING_ASSERT( untyped && typed && !unset );
+    TESTING_ASSERT( untyped->size() == typed->size() );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    readTest();
+    return 0;
+}
@@ -0,0 +1,122 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// the loop ComputeBoundsFromPositions used before it was vectorized
+template <class VEC>
+Box3d extendBounds( const std::vector< VEC > & iPoints )
+{
+    Box3d ret;
+    for ( size_t i = 0; i < iPoints.size(); ++i )
+    {
+        ret.extendBy( iPoints[i] );
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+template <class FUNC>
+double timeBounds( FUNC iFunc, size_t iNumRuns, Box3d & oBounds )
+{
+    double best = 0.0;
+    for ( size_t i = 0; i < iNumRuns; ++i )
+    {
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        oBounds = iFunc();
+        double secs = std::chrono::duration< double >(
+            std::chrono::steady_clock::now() - start ).count();
+        if ( i == 0 || secs < best )
+        {
+            best = secs;
+        }
+    }
+    return best;
+}
+
+//-*****************************************************************************
+template <class VEC>
+void benchmark( const char * iName, size_t iNumPoints, size_t iNumRuns )
+{
+    typedef typename VEC::BaseType T;
+
+    std::vector< VEC > points( iNumPoints );
+    uint32_t seed = 5;
+    for ( size_t i = 0; i < iNumPoints; ++i )
+    {
+        for ( size_t c = 0; c < 3; ++c )
+        {
+            seed = seed * 1103515245 + 12345;
+            points[i][c] = ( T ) ( ( seed >> 8 ) & 0xffff ) - ( T ) 32768;
+        }
+    }
+
+    Box3d loopBounds;
+    Box3d bounds;
+    double loopSecs = timeBounds(
+        [&]() { return extendBounds( points ); }, iNumRuns, loopBounds );
+    double secs = timeBounds(
+        [&]() { return ComputeBoundsFromPositions( &points.front(),
+                                                   points.size() ); },
+        iNumRuns, bounds );
+
+    std::cout << iName << " " << iNumPoints << " points, extendBy loop: "
+              << loopSecs * 1000.0 << " ms, ComputeBoundsFromPositions: "
+              << secs * 1000.0 << " ms, " << loopSecs / secs << "x"
+              << ( bounds == loopBounds ? "" : " MISMATCH" ) << std::endl;
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    size_t numPoints = 10 * 1000 * 1000;
+    if ( argc > 1 )
+    {
+        numPoints = strtoul( argv[1], NULL, 10 );
+    }
+
+    benchmark< V3f >( "V3f", numPoints, 5 );
+    benchmark< V3d >( "V3d", numPoints, 5 );
+    return 0;
+}
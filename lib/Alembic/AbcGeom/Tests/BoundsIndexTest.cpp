@@ -0,0 +1,292 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <algorithm>
+
+using namespace Alembic::AbcGeom;
+
+static const size_t kNumXforms = 200;
+static const size_t kNumFrames = 4;
+
+//-*****************************************************************************
+V3d gridPosition( size_t iIndex, size_t iFrame )
+{
+    double z = ( iIndex % 2 == 0 ) ? 2.0 * iFrame : 0.0;
+    return V3d( 3.0 * ( iIndex % 20 ), 3.0 * ( iIndex / 20 ), z );
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    uint32_t tsIdx = archive.addTimeSampling(
+        TimeSampling( 1.0 / 24.0, 0.0 ) );
+    OObject top = archive.getTop();
+
+    std::vector< V3f > verts;
+    for ( size_t i = 0; i < 8; ++i )
+    {
+        verts.push_back( V3f( i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f,
+                              i & 4 ? 0.5f : -0.5f ) );
+    }
+    int32_t indices[] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+    int32_t counts[] = { 4, 4 };
+
+    V3fArraySample vertSamp( verts );
+    Int32ArraySample indexSamp( indices, 8 );
+    Int32ArraySample countSamp( counts, 2 );
+    OPolyMeshSchema::Sample meshSamp( vertSamp, indexSamp, countSamp );
+
+    for ( size_t i = 0; i < kNumXforms; ++i )
+    {
+        std::ostringstream name;
+        name << "x" << i;
+        OXform xform( top, name.str(), tsIdx );
+        for ( size_t j = 0; j < kNumFrames; ++j )
+        {
+            XformSample samp;
+            samp.setTranslation( gridPosition( i, j ) );
+            xform.getSchema().set( samp );
+        }
+
+        OPolyMesh mesh( xform, "mesh" );
+        mesh.getSchema().set( meshSamp );
+    }
+
+    // an unexpanded procedural, only its child bounds
+    OXform proc( top, "proc" );
+    XformSample procSamp;
+    procSamp.setScale( V3d( 2.0, 2.0, 2.0 ) );
+    proc.getSchema().set( procSamp );
+    proc.getSchema().getChildBoundsProperty().set(
+        Box3d( V3d( 50.0, 0.0, 0.0 ), V3d( 51.0, 1.0, 1.0 ) ) );
+}
+
+//-*****************************************************************************
+bool overlaps( const Box3d & iA, const Box3d & iB )
+{
+    return iA.min.x <= iB.max.x && iA.max.x >= iB.min.x &&
+        iA.min.y <= iB.max.y && iA.max.y >= iB.min.y &&
+        iA.min.z <= iB.max.z && iA.max.z >= iB.min.z;
+}
+
+//-*****************************************************************************
+std::vector< std::string > bruteForce( const IBoundsIndex & iIndex,
+                                       const Box3d & iBox )
+{
+    std::vector< std::string > ret;
+    for ( size_t i = 0; i < iIndex.getNumEntries(); ++i )
+    {
+        if ( overlaps( iIndex.getBounds( i ), iBox ) )
+        {
+            ret.push_back( iIndex.getFullName( i ) );
+        }
+    }
+    std::sort( ret.begin(), ret.end() );
+    return ret;
+}
+
+//-*****************************************************************************
+std::vector< std::string > names( const IBoundsIndex & iIndex,
+                                  const std::vector< size_t > & iIndices )
+{
+    std::vector< std::string > ret;
+    for ( size_t i = 0; i < iIndices.size(); ++i )
+    {
+        ret.push_back( iIndex.getFullName( iIndices[i] ) );
+    }
+    std::sort( ret.begin(), ret.end() );
+    return ret;
+}
+
+//-*****************************************************************************
+// an orthographic view of exactly iBox
+M44d orthoClip( const Box3d & iBox )
+{
+    V3d center = iBox.center();
+    V3d half = iBox.size() * 0.5;
+
+    M44d ret;
+    ret.makeIdentity();
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        ret.x[i][i] = 1.0 / half[i];
+        ret.x[3][i] = -center[i] / half[i];
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+void checkQueries( const IBoundsIndex & iIndex )
+{
+    Box3d regions[] = {
+        Box3d( V3d( -0.25, -0.25, -0.25 ), V3d( 0.25, 0.25, 0.25 ) ),
+        Box3d( V3d( 4.25, 7.75, -1.25 ), V3d( 20.75, 30.25, 1.25 ) ),
+        Box3d( V3d( 10.25, 10.25, 2.75 ), V3d( 40.25, 80.25, 9.25 ) ),
+        Box3d( V3d( 99.75, 0.25, 0.25 ), V3d( 100.25, 1.0, 1.0 ) ),
+        Box3d( V3d( -100.0, -100.0, -100.0 ), V3d( 200.0, 200.0, 200.0 ) ),
+        Box3d( V3d( 500.0, 500.0, 500.0 ), V3d( 501.0, 501.0, 501.0 ) ) };
+
+    std::vector< size_t > found;
+    for ( size_t i = 0; i < sizeof( regions ) / sizeof( Box3d ); ++i )
+    {
+        std::vector< std::string > expected = bruteForce( iIndex, regions[i] );
+
+        iIndex.queryBox( regions[i], found );
+        TESTING_ASSERT( names( iIndex, found ) == expected );
+
+        iIndex.queryFrustum( orthoClip( regions[i] ), found );
+        TESTING_ASSERT( names( iIndex, found ) == expected );
+    }
+
+    iIndex.queryBox( Box3d(), found );
+    TESTING_ASSERT( found.empty() );
+}
+
+//-*****************************************************************************
+void indexTest()
+{
+    std::string archiveName = "boundsIndex.abc";
+    std::string sidecarName = "boundsIndexSidecar.abc";
+    writeArchive( archiveName );
+
+    std::vector< chrono_t > times;
+    for ( size_t i = 0; i < kNumFrames; ++i )
+    {
+        times.push_back( i / 24.0 );
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName );
+        IBoundsIndex index( archive.getTop() );
+        TESTING_ASSERT( index.getNumEntries() == kNumXforms + 1 );
+        TESTING_ASSERT( index.getIndex( "/x3" ) == IBoundsIndex::kInvalidIndex );
+
+        size_t procIdx = index.getIndex( "/proc" );
+        TESTING_ASSERT( procIdx != IBoundsIndex::kInvalidIndex );
+
+        for ( size_t frame = 0; frame < kNumFrames; ++frame )
+        {
+            index.evaluate( ISampleSelector( times[frame] ) );
+
+            for ( size_t i = 0; i < kNumXforms; ++i )
+            {
+                std::ostringstream name;
+                name << "/x" << i << "/mesh";
+                size_t idx = index.getIndex( name.str() );
+                TESTING_ASSERT( idx != IBoundsIndex::kInvalidIndex );
+
+                V3d pos = gridPosition( i, frame );
+                Box3d expected( pos - V3d( 0.5, 0.5, 0.5 ),
+                                pos + V3d( 0.5, 0.5, 0.5 ) );
+                TESTING_ASSERT( index.getBounds( idx ) == expected );
+            }
+
+            TESTING_ASSERT( index.getBounds( procIdx ) == Box3d(
+                V3d( 100.0, 0.0, 0.0 ), V3d( 102.0, 2.0, 2.0 ) ) );
+
+            Box3d total = index.getTotalBounds();
+            TESTING_ASSERT( total.min == V3d( -0.5, -0.5, -0.5 ) );
+            TESTING_ASSERT( total.max == V3d( 102.0, 27.5,
+                std::max( 2.0 * frame + 0.5, 2.0 ) ) );
+
+            checkQueries( index );
+        }
+
+        // a 90 degree perspective view looking down -z from in front of the
+        // grid sees part of it, and nothing once it moves behind it
+        M44d proj;
+        proj.makeIdentity();
+        proj.x[2][3] = -1.0;
+        proj.x[3][3] = 0.0;
+        proj.x[2][2] = -1.0;
+        proj.x[3][2] = -0.2;
+
+        M44d view;
+        view.setTranslation( V3d( -50.0, -10.0, -20.0 ) );
+
+        std::vector< size_t > found;
+        index.queryFrustum( view * proj, found );
+        TESTING_ASSERT( !found.empty() && found.size() < kNumXforms );
+
+        view.setTranslation( V3d( -50.0, -10.0, 20.0 ) );
+        index.queryFrustum( view * proj, found );
+        TESTING_ASSERT( found.empty() );
+
+        OArchive sidecar( Alembic::AbcCoreOgawa::WriteArchive(), sidecarName );
+        index.write( sidecar.getTop().getProperties(), times );
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName );
+        IArchive sidecar( Alembic::AbcCoreOgawa::ReadArchive(), sidecarName );
+
+        IBoundsIndex index( archive.getTop() );
+        IBoundsIndex written( ICompoundProperty(
+            sidecar.getTop().getProperties(), ".boundsIndex" ) );
+        TESTING_ASSERT( written.getNumEntries() == index.getNumEntries() );
+
+        // go backwards to make sure the refit shrinks the tree again
+        for ( size_t frame = kNumFrames; frame > 0; --frame )
+        {
+            index.evaluate( ISampleSelector( times[frame - 1] ) );
+            written.evaluate( ISampleSelector( times[frame - 1] ) );
+
+            for ( size_t i = 0; i < index.getNumEntries(); ++i )
+            {
+                TESTING_ASSERT( written.getFullName( i ) ==
+                                index.getFullName( i ) );
+                TESTING_ASSERT( written.getBounds( i ) == index.getBounds( i ) );
+            }
+
+            TESTING_ASSERT( written.getTotalBounds() ==
+                            index.getTotalBounds() );
+            checkQueries( written );
+        }
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    indexTest();
+    return 0;
+}
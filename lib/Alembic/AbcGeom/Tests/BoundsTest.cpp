@@ -0,0 +1,170 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <limits>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// what ComputeBoundsFromPositions used to do for everything
+template <class VEC>
+Box3d extendBounds( const std::vector< VEC > & iPoints )
+{
+    Box3d ret;
+    for ( size_t i = 0; i < iPoints.size(); ++i )
+    {
+        ret.extendBy( iPoints[i] );
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+template <class VEC>
+void checkBounds( const std::vector< VEC > & iPoints )
+{
+    Box3d expected = extendBounds( iPoints );
+    Box3d bnds = ComputeBoundsFromPositions(
+        iPoints.empty() ? NULL : &iPoints.front(), iPoints.size() );
+    TESTING_ASSERT( bnds.min == expected.min );
+    TESTING_ASSERT( bnds.max == expected.max );
+}
+
+//-*****************************************************************************
+template <class VEC>
+void boundsTest()
+{
+    typedef typename VEC::BaseType T;
+
+    uint32_t seed = 11;
+    std::vector< VEC > points;
+
+    // every size around the register widths, with the extremes in every
+    // position
+    for ( size_t n = 0; n < 40; ++n )
+    {
+        points.resize( n );
+        for ( size_t i = 0; i < n; ++i )
+        {
+            for ( size_t c = 0; c < 3; ++c )
+            {
+                seed = seed * 1103515245 + 12345;
+                points[i][c] = ( T ) ( ( ( seed >> 8 ) & 0xffff ) - 32768.0 ) /
+                    ( T ) 16.0;
+            }
+        }
+        checkBounds( points );
+
+        for ( size_t i = 0; i < n; ++i )
+        {
+            std::vector< VEC > moved( points );
+            moved[i] = VEC( ( T ) -1e6, ( T ) 1e6, ( T ) -1e7 );
+            checkBounds( moved );
+        }
+    }
+
+    // NaNs get skipped
+    const T nan = std::numeric_limits< T >::quiet_NaN();
+    points.clear();
+    points.push_back( VEC( nan, 1, 2 ) );
+    points.push_back( VEC( 3, nan, -2 ) );
+    points.push_back( VEC( -3, 4, nan ) );
+    checkBounds( points );
+    Box3d bnds = ComputeBoundsFromPositions( &points.front(), points.size() );
+    TESTING_ASSERT( bnds.min == V3d( -3, 1, -2 ) );
+
+    // a component with nothing but NaNs stays empty
+    for ( size_t i = 0; i < 17; ++i )
+    {
+        points.push_back( VEC( nan, ( T ) i, nan ) );
+    }
+    checkBounds( points );
+
+    points.assign( 9, VEC( nan, nan, nan ) );
+    checkBounds( points );
+    TESTING_ASSERT( ComputeBoundsFromPositions( &points.front(),
+                                                points.size() ).isEmpty() );
+
+    // infinity is a real value
+    points.assign( 5, VEC( 0, 0, 0 ) );
+    points[3].y = std::numeric_limits< T >::infinity();
+    checkBounds( points );
+
+    // big enough to be split across threads
+    points.resize( 3 * 1024 * 1024 + 7 );
+    for ( size_t i = 0; i < points.size(); ++i )
+    {
+        seed = seed * 1103515245 + 12345;
+        points[i] = VEC( ( T ) ( seed >> 16 ), ( T ) i, -( T ) ( seed & 0xff ) );
+    }
+    points[points.size() / 2].x = ( T ) -1;
+    points.back().z = ( T ) 1e5;
+    checkBounds( points );
+}
+
+//-*****************************************************************************
+void sampleTest()
+{
+    std::vector< V3f > points;
+    points.push_back( V3f( 1, 2, 3 ) );
+    points.push_back( V3f( -1, 5, 0 ) );
+
+    Box3d expected( V3d( -1, 2, 0 ), V3d( 1, 5, 3 ) );
+    TESTING_ASSERT( ComputeBoundsFromPositions(
+        P3fArraySample( points ) ) == expected );
+    TESTING_ASSERT( ComputeBoundsFromPositions(
+        V3fArraySample( points ) ) == expected );
+    TESTING_ASSERT( ComputeBoundsFromPositions( P3fArraySample() ).isEmpty() );
+
+    std::vector< V3d > dpoints;
+    dpoints.push_back( V3d( 1, 2, 3 ) );
+    dpoints.push_back( V3d( -1, 5, 0 ) );
+    TESTING_ASSERT( ComputeBoundsFromPositions(
+        P3dArraySample( dpoints ) ) == expected );
+    TESTING_ASSERT( ComputeBoundsFromPositions(
+        V3dArraySample( dpoints ) ) == expected );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    boundsTest< V3f >();
+    boundsTest< V3d >();
+    sampleTest();
+    return 0;
+}
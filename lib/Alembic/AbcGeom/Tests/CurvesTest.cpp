@@ -278,6 +278,109 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+void offsetsTest()
+{
+    std::string name = "curveOffsetsTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OCurves curvesObj( OObject( archive, kTop ), "curves" );
+
+        std::vector< V3f > pts( 21, V3f( 0.0f, 0.0f, 0.0f ) );
+        int32_t nv[] = { 4, 7, 10 };
+        int32_t nv2[] = { 4, 17 };
+
+        // the first two samples share nVertices
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            OCurvesSchema::Sample curveSamp( P3fArraySample( pts ),
+                Int32ArraySample( i < 2 ? nv : nv2, i < 2 ? 3 : 2 ) );
+            curvesObj.getSchema().set( curveSamp );
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+        ICurves curvesObj( IObject( archive, kTop ), "curves" );
+        ICurvesSchema &curves = curvesObj.getSchema();
+
+        ICurvesSchema::Sample samp0;
+        curves.get( samp0, ISampleSelector( ( index_t ) 0 ) );
+
+        UInt64ArraySamplePtr verts = samp0.getVertexOffsets();
+        TESTING_ASSERT( verts->size() == 4 );
+        TESTING_ASSERT( ( *verts )[0] == 0 && ( *verts )[1] == 4 &&
+                        ( *verts )[2] == 11 && ( *verts )[3] == 21 );
+
+        // bezier curves have a varying value at the ends of each segment
+        UInt64ArraySamplePtr varying = samp0.getOffsets( kVaryingScope );
+        TESTING_ASSERT( varying->size() == 4 );
+        TESTING_ASSERT( ( *varying )[0] == 0 && ( *varying )[1] == 2 &&
+                        ( *varying )[2] == 5 && ( *varying )[3] == 9 );
+        TESTING_ASSERT( samp0.getOffsets( kFacevaryingScope ) == varying );
+
+        UInt64ArraySamplePtr uniform = samp0.getOffsets( kUniformScope );
+        TESTING_ASSERT( ( *uniform )[3] == 3 );
+
+        TESTING_ASSERT( !samp0.getOffsets( kConstantScope ) );
+
+        // same nVertices, same offsets
+        ICurvesSchema::Sample samp1;
+        curves.get( samp1, ISampleSelector( ( index_t ) 1 ) );
+        TESTING_ASSERT( samp1.getVertexOffsets() == verts );
+        TESTING_ASSERT( samp1.getOffsets( kVaryingScope ) == varying );
+
+        ICurvesSchema::Sample samp2;
+        IArrayReadGroup group;
+        curves.get( samp2, ISampleSelector( ( index_t ) 2 ), group );
+        group.read();
+        UInt64ArraySamplePtr verts2 = samp2.getVertexOffsets();
+        TESTING_ASSERT( verts2 != verts && verts2->size() == 3 );
+        TESTING_ASSERT( ( *verts2 )[1] == 4 && ( *verts2 )[2] == 21 );
+        TESTING_ASSERT( ( *samp2.getOffsets( kVaryingScope ) )[2] == 8 );
+
+        // alternating between topologies keeps both
+        TESTING_ASSERT( samp0.getVertexOffsets() == verts );
+        TESTING_ASSERT( samp2.getVertexOffsets() == verts2 );
+        TESTING_ASSERT( ( *samp0.getVertexOffsets() )[3] == 21 );
+    }
+
+    // enough curves to be summed on several threads
+    std::vector< int32_t > nv( 1024 * 1024 + 3 );
+    for ( size_t i = 0; i < nv.size(); ++i )
+    {
+        nv[i] = 4 + i % 5;
+    }
+
+    Int32ArraySamplePtr nvSamp( new Int32ArraySample( nv ) );
+
+    // automatic, then forced so the threaded path runs even on one core
+    size_t numThreads[] = { 0, 1, 3, 4 };
+    for ( size_t t = 0; t < 4; ++t )
+    {
+        UInt64ArraySamplePtr offsets = CurvesOffsetsCache::computeOffsets(
+            kVaryingScope, nvSamp, kCubic, kNonPeriodic, kCatmullromBasis,
+            UcharArraySamplePtr(), numThreads[t] );
+
+        TESTING_ASSERT( offsets->size() == nv.size() + 1 );
+        uint64_t total = 0;
+        for ( size_t i = 0; i < nv.size(); ++i )
+        {
+            TESTING_ASSERT( ( *offsets )[i] == total );
+            total += nv[i] - 2;
+        }
+        TESTING_ASSERT( ( *offsets )[nv.size()] == total );
+    }
+
+    // more threads than curves
+    int32_t fewNv[] = { 4, 5 };
+    UInt64ArraySamplePtr few = CurvesOffsetsCache::computeOffsets(
+        kVertexScope, Int32ArraySamplePtr( new Int32ArraySample( fewNv, 2 ) ),
+        kCubic, kNonPeriodic, kBezierBasis, UcharArraySamplePtr(), 8 );
+    TESTING_ASSERT( few->size() == 3 && ( *few )[0] == 0 &&
+                    ( *few )[1] == 4 && ( *few )[2] == 9 );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -304,6 +407,7 @@ int main( int argc, char *argv[] )
     Example2_CurvesIn();
 
     sparseTest();
+    offsetsTest();
 
     return 0;
 }
@@ -352,6 +352,120 @@ void IndexexedGeomParamTest()
     }
 }
 
+void ExpandedBufferTest()
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "expandedBuffer.abc" );
+        OCompoundProperty prop = archive.getTop().getProperties();
+        TimeSamplingPtr ts( new TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+        std::vector< V2f > uvs;
+        for ( size_t i = 0; i < 8; ++i )
+        {
+            uvs.push_back( V2f( i, 0.5f * i ) );
+        }
+
+        std::vector< Alembic::Util::uint32_t > indices;
+        for ( size_t i = 0; i < 100; ++i )
+        {
+            indices.push_back( ( i * 7 ) % 8 );
+        }
+
+        V2fArraySample uvSamp( uvs );
+        UInt32ArraySample indicesSamp( indices );
+
+        // constant values, indices that change once
+        OV2fGeomParam uv( prop, "uv", true, kFacevaryingScope, 1, ts );
+
+        // not indexed, changes every time
+        std::vector< N3f > normals( 10, N3f( 0.0f, 1.0f, 0.0f ) );
+        ON3fGeomParam n( prop, "N", false, kVertexScope, 1, ts );
+
+        // not indexed, but the same values as uv
+        OV2fGeomParam uvFlat( prop, "uvFlat", false, kVertexScope, 1, ts );
+        uvFlat.set( OV2fGeomParam::Sample( uvSamp, kVertexScope ) );
+
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            if ( i == 2 )
+            {
+                indices[0] = 7;
+                indicesSamp = UInt32ArraySample( indices );
+            }
+            uv.set( OV2fGeomParam::Sample( uvSamp, indicesSamp,
+                                           kFacevaryingScope ) );
+
+            normals[0].x = i;
+            n.set( ON3fGeomParam::Sample( N3fArraySample( normals ),
+                                          kVertexScope ) );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "expandedBuffer.abc" );
+    ICompoundProperty prop = archive.getTop().getProperties();
+
+    IV2fGeomParam uv( prop, "uv" );
+    IN3fGeomParam n( prop, "N" );
+
+    IV2fGeomParam::ExpandedBuffer uvBuffer;
+    IN3fGeomParam::ExpandedBuffer nBuffer;
+    for ( index_t i = 0; i < 4; ++i )
+    {
+        ISampleSelector ss( i );
+
+        // only recomputed when the indices change
+        TESTING_ASSERT( uv.getExpanded( uvBuffer, ss ) == ( i == 0 || i == 2 ) );
+        TESTING_ASSERT( n.getExpanded( nBuffer, ss ) );
+
+        IV2fGeomParam::Sample uvSamp = uv.getExpandedValue( ss );
+        TESTING_ASSERT( uvBuffer.size() == 100 );
+        TESTING_ASSERT( uvSamp.getVals()->size() == uvBuffer.size() );
+        for ( size_t j = 0; j < uvBuffer.size(); ++j )
+        {
+            TESTING_ASSERT( ( *uvSamp.getVals() )[j] == uvBuffer[j] );
+        }
+        TESTING_ASSERT( uvBuffer[0] == ( i < 2 ? V2f( 0.0f, 0.0f ) :
+                                         V2f( 7.0f, 3.5f ) ) );
+
+        IN3fGeomParam::Sample nSamp = n.getExpandedValue( ss );
+        TESTING_ASSERT( nBuffer.size() == 10 && nBuffer.get() == &nBuffer[0] );
+        for ( size_t j = 0; j < nBuffer.size(); ++j )
+        {
+            TESTING_ASSERT( ( *nSamp.getVals() )[j] == nBuffer[j] );
+        }
+        TESTING_ASSERT( nBuffer[0].x == i );
+    }
+
+    // the same sample again doesn't need anything
+    TESTING_ASSERT( !n.getExpanded( nBuffer, ISampleSelector( index_t( 3 ) ) ) );
+
+    nBuffer.reset();
+    TESTING_ASSERT( nBuffer.size() == 0 );
+    TESTING_ASSERT( n.getExpanded( nBuffer, ISampleSelector( index_t( 3 ) ) ) );
+    TESTING_ASSERT( nBuffer.size() == 10 );
+
+    // a buffer gathered through indices isn't reused for the same values
+    // without them
+    IV2fGeomParam uvFlat( prop, "uvFlat" );
+    TESTING_ASSERT( uvBuffer.size() == 100 );
+    TESTING_ASSERT( uvFlat.getExpanded( uvBuffer ) );
+    TESTING_ASSERT( uvBuffer.size() == 8 && uvBuffer[7] == V2f( 7.0f, 3.5f ) );
+    TESTING_ASSERT( !uvFlat.getExpanded( uvBuffer ) );
+    TESTING_ASSERT( uv.getExpanded( uvBuffer, ISampleSelector( index_t( 3 ) ) ) );
+    TESTING_ASSERT( uvBuffer.size() == 100 );
+
+    // a string param uses the same path
+    IArchive strArchive( Alembic::AbcCoreOgawa::ReadArchive(),
+                         "indexedGeomParam.abc" );
+    IStringGeomParam avai( strArchive.getTop().getProperties(), "avai" );
+    IStringGeomParam::ExpandedBuffer strBuffer;
+    TESTING_ASSERT( avai.getExpanded( strBuffer, ISampleSelector( 1.0/24.0 ) ) );
+    TESTING_ASSERT( strBuffer.size() == 4 && strBuffer[0] == "aa" &&
+                    strBuffer[3] == "aa" );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -362,6 +476,7 @@ void IndexexedGeomParamTest()
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
+//-*****************************************************************************
 int main( int argc, char *argv[] )
 {
 
@@ -375,5 +490,7 @@ int main( int argc, char *argv[] )
     Example1_GeomBaseIn();
 
     IndexexedGeomParamTest();
+
+    ExpandedBufferTest();
     return 0;
 }
@@ -415,6 +415,225 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+void topologyCacheTest()
+{
+    std::string name = "meshTopologyCacheTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPolyMesh homogenousObj( OObject( archive, kTop ), "homogenous" );
+        OPolyMesh heterogenousObj( OObject( archive, kTop ), "heterogenous" );
+
+        std::vector< V3f > verts( g_numVerts );
+        for ( size_t i = 0; i < g_numVerts; ++i )
+        {
+            verts[i] = V3f( g_verts[3*i], g_verts[3*i+1], g_verts[3*i+2] );
+        }
+
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            OPolyMeshSchema::Sample mesh_samp( V3fArraySample( verts ),
+                Int32ArraySample( g_indices, g_numIndices ),
+                Int32ArraySample( g_counts, g_numCounts ) );
+            homogenousObj.getSchema().set( mesh_samp );
+
+            // drop the last face on each sample
+            mesh_samp.setFaceIndices( Int32ArraySample( g_indices,
+                g_numIndices - 4 * i ) );
+            mesh_samp.setFaceCounts( Int32ArraySample( g_counts,
+                g_numCounts - i ) );
+            heterogenousObj.getSchema().set( mesh_samp );
+
+            for ( size_t j = 0; j < g_numVerts; ++j )
+            {
+                verts[j] *= 2;
+            }
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+
+        IPolyMesh homogenousObj( IObject( archive, kTop ), "homogenous" );
+        IPolyMeshSchema mesh = homogenousObj.getSchema();
+        TESTING_ASSERT( mesh.getTopologyVariance() == kHomogenousTopology );
+
+        // the topology is only read once and then shared, the positions
+        // aren't
+        IPolyMeshSchema::Sample samp0 = mesh.getValue( 0 );
+        IPolyMeshSchema::Sample samp2 = mesh.getValue( 2 );
+        TESTING_ASSERT( samp0.getFaceIndices() == samp2.getFaceIndices() );
+        TESTING_ASSERT( samp0.getFaceCounts() == samp2.getFaceCounts() );
+        TESTING_ASSERT( samp0.getPositions() != samp2.getPositions() );
+        TESTING_ASSERT( samp0.getFaceIndices()->size() == g_numIndices );
+        TESTING_ASSERT( samp0.getFaceCounts()->size() == g_numCounts );
+        TESTING_ASSERT( (*samp2.getPositions())[0] ==
+                        (*samp0.getPositions())[0] * 4 );
+
+        // copies share it too, as does reading through a group
+        IPolyMeshSchema meshCopy = mesh;
+        IPolyMeshSchema::Sample samp1;
+        IArrayReadGroup group;
+        meshCopy.get( samp1, 1, group );
+        TESTING_ASSERT( samp1.getFaceIndices() == samp0.getFaceIndices() );
+        TESTING_ASSERT( group.getNumReads() == 1 );
+        group.read();
+        TESTING_ASSERT( (*samp1.getPositions())[0] ==
+                        (*samp0.getPositions())[0] * 2 );
+
+        // the topology read through a group is cached too
+        IPolyMesh groupedObj( IObject( archive, kTop ), "homogenous" );
+        IPolyMeshSchema grouped = groupedObj.getSchema();
+        IPolyMeshSchema::Sample gsamp0, gsamp2;
+        grouped.get( gsamp0, 0, group );
+        TESTING_ASSERT( group.getNumReads() == 3 );
+        group.read();
+        grouped.get( gsamp2, 2, group );
+        TESTING_ASSERT( group.getNumReads() == 1 );
+        group.read();
+        TESTING_ASSERT( gsamp0.getFaceIndices() == gsamp2.getFaceIndices() );
+        TESTING_ASSERT( gsamp0.getFaceCounts() == gsamp2.getFaceCounts() );
+        TESTING_ASSERT( gsamp0.getFaceIndices()->size() == g_numIndices );
+        TESTING_ASSERT( gsamp0.getPositions() != gsamp2.getPositions() );
+
+        IPolyMesh heterogenousObj( IObject( archive, kTop ), "heterogenous" );
+        mesh = heterogenousObj.getSchema();
+        TESTING_ASSERT( mesh.getTopologyVariance() == kHeterogenousTopology );
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            IPolyMeshSchema::Sample samp = mesh.getValue( i );
+            TESTING_ASSERT( samp.getFaceIndices()->size() ==
+                            g_numIndices - 4 * i );
+            TESTING_ASSERT( samp.getFaceCounts()->size() == g_numCounts - i );
+        }
+    }
+}
+
+//-*****************************************************************************
+void faceSetsTest()
+{
+    std::string name = "meshFaceSetsTest.abc";
+    const size_t numFaceSets = 500;
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        TimeSamplingPtr ts( new TimeSampling( 1.0 / 24.0, 0.0 ) );
+        OPolyMesh meshObj( OObject( archive, kTop ), "mesh", ts );
+        OPolyMeshSchema &mesh = meshObj.getSchema();
+
+        std::vector< V3f > verts( g_numVerts );
+        for ( size_t i = 0; i < g_numVerts; ++i )
+        {
+            verts[i] = V3f( g_verts[3*i], g_verts[3*i+1], g_verts[3*i+2] );
+        }
+
+        V3fArraySample vertSamp( verts );
+        Int32ArraySample indexSamp( g_indices, g_numIndices );
+        Int32ArraySample countSamp( g_counts, g_numCounts );
+        OPolyMeshSchema::Sample mesh_samp( vertSamp, indexSamp, countSamp );
+        mesh.set( mesh_samp );
+        mesh.set( mesh_samp );
+
+        for ( size_t i = 0; i < numFaceSets; ++i )
+        {
+            std::ostringstream faceSetName;
+            faceSetName << "faceSet" << i;
+            OFaceSetSchema faceSet = mesh.createFaceSet(
+                faceSetName.str() ).getSchema();
+
+            // every 10th set gets another face on the second sample
+            std::vector< Alembic::Util::int32_t > faces( i % 4,
+                static_cast< Alembic::Util::int32_t >( i ) );
+            if ( i % 10 == 0 )
+            {
+                faceSet.setTimeSampling( ts );
+            }
+
+            faceSet.set( OFaceSetSchema::Sample( faces ) );
+            if ( i % 10 == 0 )
+            {
+                faces.push_back( -1 );
+                faceSet.set( OFaceSetSchema::Sample( faces ) );
+            }
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+        IPolyMesh meshObj( IObject( archive, kTop ), "mesh" );
+        IPolyMeshSchema mesh = meshObj.getSchema();
+
+        std::vector< std::string > names;
+        mesh.getFaceSetNames( names );
+        TESTING_ASSERT( names.size() == numFaceSets );
+
+        for ( index_t s = 0; s < 2; ++s )
+        {
+            FaceSetsSample faceSets;
+            mesh.getFaceSets( faceSets, ISampleSelector( s ) );
+            TESTING_ASSERT( faceSets.getNumFaceSets() == numFaceSets );
+            TESTING_ASSERT( faceSets.getNames() == names );
+            TESTING_ASSERT( faceSets.getOffsets().size() == numFaceSets + 1 );
+            TESTING_ASSERT( faceSets.getOffsets().back() ==
+                            faceSets.getFaces().size() );
+
+            for ( size_t i = 0; i < numFaceSets; ++i )
+            {
+                IFaceSetSchema::Sample samp;
+                mesh.getFaceSet( names[i] ).getSchema().get( samp,
+                    ISampleSelector( s ) );
+
+                size_t start = faceSets.getOffsets()[i];
+                size_t end = faceSets.getOffsets()[i + 1];
+                TESTING_ASSERT( end - start == samp.getFaces()->size() );
+                for ( size_t j = start; j < end; ++j )
+                {
+                    TESTING_ASSERT( faceSets.getFaces()[j] ==
+                                    ( *samp.getFaces() )[j - start] );
+                }
+            }
+        }
+
+        // the same again on more threads, with a fresh schema so the face
+        // sets are opened by getFaceSets
+        IPolyMeshSchema fresh = IPolyMesh( IObject( archive, kTop ),
+                                           "mesh" ).getSchema();
+        FaceSetsSample threaded;
+        fresh.getFaceSets( threaded, ISampleSelector( index_t( 1 ) ), 4 );
+
+        FaceSetsSample serial;
+        mesh.getFaceSets( serial, ISampleSelector( index_t( 1 ) ) );
+        TESTING_ASSERT( threaded.getNames() == serial.getNames() );
+        TESTING_ASSERT( threaded.getFaces() == serial.getFaces() );
+        TESTING_ASSERT( threaded.getOffsets() == serial.getOffsets() );
+
+        // a caller owned group, reused for both samples and shared with the
+        // mesh's own reads
+        IArrayReadGroup group( 4 );
+        for ( index_t s = 0; s < 2; ++s )
+        {
+            FaceSetsSample grouped;
+            IPolyMeshSchema::Sample meshSamp;
+            fresh.getFaceSets( grouped, ISampleSelector( s ), group );
+            fresh.get( meshSamp, ISampleSelector( s ), group );
+            TESTING_ASSERT( grouped.getNumFaceSets() == 0 );
+            TESTING_ASSERT( group.getNumReads() > numFaceSets );
+            group.read();
+
+            FaceSetsSample expected;
+            mesh.getFaceSets( expected, ISampleSelector( s ) );
+            TESTING_ASSERT( grouped.getNames() == expected.getNames() );
+            TESTING_ASSERT( grouped.getFaces() == expected.getFaces() );
+            TESTING_ASSERT( grouped.getOffsets() == expected.getOffsets() );
+            TESTING_ASSERT( meshSamp.getPositions() );
+        }
+
+        serial.reset();
+        TESTING_ASSERT( serial.getNumFaceSets() == 0 );
+        TESTING_ASSERT( serial.getOffsets().size() == 1 );
+    }
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -437,5 +656,8 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    topologyCacheTest();
+    faceSetsTest();
+
     return 0;
 }
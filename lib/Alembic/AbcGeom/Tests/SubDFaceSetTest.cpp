@@ -192,6 +192,17 @@ void Example1_MeshIn()
     faceSet = faceSetObj.getSchema();
     TESTING_ASSERT ( faceSet.getFaceExclusivity() == kFaceSetNonExclusive );
 
+    // all of them at once
+    FaceSetsSample faceSets;
+    mesh.getFaceSets( faceSets );
+    TESTING_ASSERT( faceSets.getNumFaceSets() == 2 );
+    TESTING_ASSERT( faceSets.getNames() == faceSetNames );
+    TESTING_ASSERT( faceSets.getOffsets()[1] == 3 );
+    TESTING_ASSERT( faceSets.getOffsets()[2] == 3 );
+    TESTING_ASSERT( faceSets.getFaces()[0] == 1 &&
+                    faceSets.getFaces()[1] == 2 &&
+                    faceSets.getFaces()[2] == 3 );
+
     // end of FaceSet testing
 
     // UVs
@@ -250,6 +250,36 @@ void Example1_MeshIn()
 
     TESTING_ASSERT( 0 == samp2.getInterpolateBoundary() );
 
+    // the topology is constant so both samples share it
+    TESTING_ASSERT( mesh.getTopologyVariance() == kConstantTopology );
+    TESTING_ASSERT( samp1.getFaceIndices() == samp2.getFaceIndices() );
+    TESTING_ASSERT( samp1.getFaceCounts() == samp2.getFaceCounts() );
+    TESTING_ASSERT( samp1.getCreaseSharpnesses() ==
+                    samp2.getCreaseSharpnesses() );
+    TESTING_ASSERT( samp1.getHoles() == samp2.getHoles() );
+    TESTING_ASSERT( samp2.getFaceIndices()->size() == g_numIndices );
+    TESTING_ASSERT( samp2.getCornerIndices()->size() == 24 );
+
+    // the topology read through a group is cached too
+    {
+        ISubD groupedObj( IObject( archive, kTop ), "subd" );
+        ISubDSchema grouped = groupedObj.getSchema();
+        ISubDSchema::Sample gsamp1, gsamp2;
+        IArrayReadGroup group;
+        grouped.get( gsamp1, 1, group );
+        size_t numReads = group.getNumReads();
+        group.read();
+        grouped.get( gsamp2, 2, group );
+        TESTING_ASSERT( group.getNumReads() < numReads );
+        group.read();
+        TESTING_ASSERT( gsamp1.getFaceIndices() == gsamp2.getFaceIndices() );
+        TESTING_ASSERT( gsamp1.getFaceCounts() == gsamp2.getFaceCounts() );
+        TESTING_ASSERT( gsamp1.getCornerIndices() ==
+                        gsamp2.getCornerIndices() );
+        TESTING_ASSERT( gsamp1.getHoles() == gsamp2.getHoles() );
+        TESTING_ASSERT( gsamp2.getFaceIndices()->size() == g_numIndices );
+    }
+
     std::cout << "Interpolate boundary at 2th sample: "
               << samp2.getInterpolateBoundary() << std::endl;
 
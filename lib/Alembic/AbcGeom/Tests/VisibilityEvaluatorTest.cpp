@@ -0,0 +1,166 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    uint32_t tsIdx = archive.addTimeSampling(
+        TimeSampling( 1.0 / 24.0, 0.0 ) );
+    OObject top = archive.getTop();
+
+    OObject anim( top, "anim" );
+    OObject deferred( anim, "deferred" );
+    OObject leaf( deferred, "leaf" );
+    OObject shown( anim, "shown" );
+    OObject shownLeaf( shown, "leaf" );
+    OObject hidden( top, "hidden" );
+    OObject hiddenLeaf( hidden, "leaf" );
+    OObject override( hidden, "override" );
+    OObject overrideLeaf( override, "leaf" );
+    OObject plain( top, "plain" );
+
+    OVisibilityProperty animVis = CreateVisibilityProperty( anim, tsIdx );
+    OVisibilityProperty deferredVis =
+        CreateVisibilityProperty( deferred, tsIdx );
+    OVisibilityProperty shownVis = CreateVisibilityProperty( shown, 0 );
+    OVisibilityProperty hiddenVis = CreateVisibilityProperty( hidden, 0 );
+    OVisibilityProperty overrideVis =
+        CreateVisibilityProperty( override, tsIdx );
+
+    shownVis.set( kVisibilityVisible );
+    hiddenVis.set( kVisibilityHidden );
+
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        animVis.set( i % 3 == 0 ? kVisibilityHidden : kVisibilityDeferred );
+        deferredVis.set( kVisibilityDeferred );
+
+        // changes once, halfway through
+        overrideVis.set( i < 5 ? kVisibilityDeferred : kVisibilityVisible );
+    }
+}
+
+//-*****************************************************************************
+void evaluatorTest()
+{
+    std::string archiveName = "visibilityEvaluator.abc";
+    writeArchive( archiveName );
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName );
+
+    IVisibilityEvaluator evaluator( archive.getTop() );
+    TESTING_ASSERT( evaluator.getNumObjects() == 11 );
+    TESTING_ASSERT( evaluator.getIndex( "/" ) == 0 );
+    TESTING_ASSERT( evaluator.getIndex( "/nope" ) ==
+                    IVisibilityEvaluator::kInvalidIndex );
+
+    size_t animLeaf = evaluator.getIndex( "/anim/deferred/leaf" );
+    size_t shownLeaf = evaluator.getIndex( "/anim/shown/leaf" );
+    size_t hiddenLeaf = evaluator.getIndex( "/hidden/leaf" );
+    size_t overrideLeaf = evaluator.getIndex( "/hidden/override/leaf" );
+    size_t plain = evaluator.getIndex( "/plain" );
+
+    TESTING_ASSERT( !evaluator.isConstant( animLeaf ) );
+    TESTING_ASSERT( evaluator.isConstant( shownLeaf ) );
+    TESTING_ASSERT( evaluator.isConstant( hiddenLeaf ) );
+    TESTING_ASSERT( !evaluator.isConstant( overrideLeaf ) );
+    TESTING_ASSERT( evaluator.isConstant( plain ) );
+
+    for ( index_t i = 0; i < 10; ++i )
+    {
+        ISampleSelector ss( i / 24.0 );
+        evaluator.evaluate( ss );
+
+        for ( size_t j = 0; j < evaluator.getNumObjects(); ++j )
+        {
+            IObject obj = evaluator.getObject( j );
+            TESTING_ASSERT( evaluator.getIndex( obj.getFullName() ) == j );
+            TESTING_ASSERT( evaluator.isHidden( j ) ==
+                            IsAncestorInvisible( obj, ss ) );
+            TESTING_ASSERT( evaluator.getVisibility( j ) ==
+                            GetVisibility( obj, ss ) );
+        }
+
+        TESTING_ASSERT( evaluator.isHidden( animLeaf ) == ( i % 3 == 0 ) );
+        TESTING_ASSERT( !evaluator.isHidden( shownLeaf ) );
+        TESTING_ASSERT( evaluator.isHidden( "/hidden/leaf" ) );
+        TESTING_ASSERT( evaluator.isHidden( overrideLeaf ) == ( i < 5 ) );
+        TESTING_ASSERT( !evaluator.isHidden( plain ) );
+
+        if ( i == 0 )
+        {
+            for ( size_t j = 0; j < evaluator.getNumObjects(); ++j )
+            {
+                TESTING_ASSERT( evaluator.hasChanged( j ) );
+            }
+            continue;
+        }
+
+        TESTING_ASSERT( evaluator.hasChanged( animLeaf ) ==
+                        ( i % 3 == 0 || i % 3 == 1 ) );
+        TESTING_ASSERT( !evaluator.hasChanged( shownLeaf ) );
+        TESTING_ASSERT( !evaluator.hasChanged( hiddenLeaf ) );
+        TESTING_ASSERT( evaluator.hasChanged( overrideLeaf ) == ( i == 5 ) );
+        TESTING_ASSERT( !evaluator.hasChanged( plain ) );
+    }
+
+    // evaluating below the top still sees the hidden parent
+    IObject hidden( archive.getTop(), "hidden" );
+    IVisibilityEvaluator sub( IObject( hidden, "override" ) );
+    TESTING_ASSERT( sub.getNumObjects() == 4 );
+
+    sub.evaluate( ISampleSelector( 0.0 ) );
+    TESTING_ASSERT( sub.isHidden( "/hidden/override/leaf" ) );
+
+    sub.evaluate( ISampleSelector( 9.0 / 24.0 ) );
+    TESTING_ASSERT( !sub.isHidden( "/hidden/override/leaf" ) );
+    TESTING_ASSERT( sub.isHidden( "/hidden" ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    evaluatorTest();
+    return 0;
+}
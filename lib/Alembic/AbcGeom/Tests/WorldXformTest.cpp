@@ -0,0 +1,210 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// walk from the object up to the top, the way it used to be done
+M44d accumXform( IObject iObject, const ISampleSelector & iSS )
+{
+    M44d mat;
+    for ( ; iObject.valid(); iObject = iObject.getParent() )
+    {
+        if ( IXform::matches( iObject.getHeader() ) )
+        {
+            XformSample samp = IXform( iObject ).getSchema().getValue( iSS );
+            mat = mat * samp.getMatrix();
+            if ( !samp.getInheritsXforms() )
+            {
+                break;
+            }
+        }
+    }
+    return mat;
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    uint32_t tsIdx = archive.addTimeSampling(
+        TimeSampling( 1.0 / 24.0, 0.0 ) );
+    OObject top = archive.getTop();
+
+    OXform anim( top, "anim", tsIdx );
+    OXform constXform( anim, "const" );
+    OXform noInherit( constXform, "noinherit", tsIdx );
+    OObject leaf( noInherit, "leaf" );
+    OObject plain( constXform, "plain" );
+    OXform x( plain, "x" );
+    OXform still( top, "still" );
+    OXform child( still, "child" );
+    OXform stepped( child, "stepped", tsIdx );
+
+    XformSample samp;
+    samp.setScale( V3d( 2.0, 2.0, 1.0 ) );
+    constXform.getSchema().set( samp );
+
+    samp = XformSample();
+    samp.setTranslation( V3d( 0.0, 1.0, -3.0 ) );
+    x.getSchema().set( samp );
+    still.getSchema().set( samp );
+
+    samp = XformSample();
+    samp.setYRotation( 30.0 );
+    child.getSchema().set( samp );
+
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        samp = XformSample();
+        samp.setTranslation( V3d( i, 2.0 * i, 1.0 ) );
+        anim.getSchema().set( samp );
+
+        samp = XformSample();
+        samp.setZRotation( i * 10.0 );
+        samp.setInheritsXforms( false );
+        noInherit.getSchema().set( samp );
+
+        // changes once, halfway through
+        samp = XformSample();
+        samp.setTranslation( V3d( i < 5 ? 1.0 : 2.0, 0.0, 0.0 ) );
+        stepped.getSchema().set( samp );
+    }
+}
+
+//-*****************************************************************************
+bool sameMatrix( const M44d & iA, const M44d & iB )
+{
+    return iA.equalWithAbsError( iB, 1e-9 );
+}
+
+//-*****************************************************************************
+void evaluatorTest()
+{
+    std::string archiveName = "worldXform.abc";
+    writeArchive( archiveName );
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), archiveName );
+
+    IWorldXformEvaluator evaluator( archive.getTop() );
+    TESTING_ASSERT( evaluator.getNumObjects() == 10 );
+    TESTING_ASSERT( evaluator.getIndex( "/" ) == 0 );
+    TESTING_ASSERT( evaluator.getIndex( "/nope" ) ==
+                    IWorldXformEvaluator::kInvalidIndex );
+
+    for ( size_t i = 0; i < evaluator.getNumObjects(); ++i )
+    {
+        TESTING_ASSERT( evaluator.getIndex(
+            evaluator.getObject( i ).getFullName() ) == i );
+    }
+
+    size_t animIdx = evaluator.getIndex( "/anim" );
+    size_t xIdx = evaluator.getIndex( "/anim/const/plain/x" );
+    size_t leafIdx = evaluator.getIndex( "/anim/const/noinherit/leaf" );
+    size_t stillIdx = evaluator.getIndex( "/still/child" );
+    size_t steppedIdx = evaluator.getIndex( "/still/child/stepped" );
+
+    TESTING_ASSERT( !evaluator.isConstant( animIdx ) );
+    TESTING_ASSERT( !evaluator.isConstant( xIdx ) );
+    TESTING_ASSERT( !evaluator.isConstant( leafIdx ) );
+    TESTING_ASSERT( evaluator.isConstant( stillIdx ) );
+    TESTING_ASSERT( !evaluator.isConstant( steppedIdx ) );
+
+    // forwards, backwards and jumping around
+    index_t frames[14] = { 0, 1, 2, 3, 3, 4, 5, 9, 8, 2, 6, 6, 0, 20 };
+    for ( size_t f = 0; f < 14; ++f )
+    {
+        ISampleSelector ss( frames[f] / 24.0 );
+        evaluator.evaluate( ss );
+
+        for ( size_t i = 0; i < evaluator.getNumObjects(); ++i )
+        {
+            TESTING_ASSERT( sameMatrix( evaluator.getWorldMatrix( i ),
+                accumXform( evaluator.getObject( i ), ss ) ) );
+        }
+
+        TESTING_ASSERT( sameMatrix(
+            evaluator.getWorldMatrix( "/anim/const/plain/x" ),
+            evaluator.getWorldMatrix( xIdx ) ) );
+
+        // things only change when they need to
+        bool first = ( f == 0 );
+        bool sameFrame = !first && frames[f] == frames[f - 1];
+        TESTING_ASSERT( evaluator.hasChanged( stillIdx ) == first );
+        TESTING_ASSERT( evaluator.hasChanged( animIdx ) == !sameFrame );
+        TESTING_ASSERT( evaluator.hasChanged( xIdx ) == !sameFrame );
+
+        bool steppedChanged = first ||
+            ( frames[f] < 5 ) != ( frames[f - 1] < 5 );
+        TESTING_ASSERT( evaluator.hasChanged( steppedIdx ) == steppedChanged );
+    }
+
+    // the leaf doesn't inherit past its parent
+    evaluator.evaluate( ISampleSelector( 3.0 / 24.0 ) );
+    M44d rot;
+    rot.setEulerAngles( V3d( 0.0, 0.0, DegreesToRadians( 30.0 ) ) );
+    TESTING_ASSERT( sameMatrix( evaluator.getWorldMatrix( leafIdx ), rot ) );
+    TESTING_ASSERT( sameMatrix( evaluator.getLocalMatrix( leafIdx ), M44d() ) );
+
+    // part of the hierarchy still includes the xforms above it
+    IObject constObj = IObject( archive.getTop(), "anim" ).getChild( "const" );
+    IWorldXformEvaluator sub( constObj );
+    TESTING_ASSERT( sub.getNumObjects() == 7 );
+    TESTING_ASSERT( sub.getIndex( "/still" ) ==
+                    IWorldXformEvaluator::kInvalidIndex );
+    ISampleSelector ss( 7.0 / 24.0 );
+    sub.evaluate( ss );
+    for ( size_t i = 0; i < sub.getNumObjects(); ++i )
+    {
+        TESTING_ASSERT( sameMatrix( sub.getWorldMatrix( i ),
+            accumXform( sub.getObject( i ), ss ) ) );
+    }
+
+    IWorldXformEvaluator empty( ( IObject() ) );
+    TESTING_ASSERT( empty.getNumObjects() == 0 );
+    empty.evaluate();
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    evaluatorTest();
+    return 0;
+}
@@ -125,6 +125,131 @@ void rotateTest()
     }
 }
 
+//-*****************************************************************************
+// builds the matrix the slow way, one full multiply per op
+M44d referenceMatrix( const XformSample & iSamp )
+{
+    M44d ret;
+    for ( size_t i = 0; i < iSamp.getNumOps(); ++i )
+    {
+        const XformOp & op = iSamp[i];
+        M44d m;
+        switch ( op.getType() )
+        {
+            case kScaleOperation:
+                m.setScale( op.getScale() );
+                break;
+            case kTranslateOperation:
+                m.setTranslation( op.getTranslate() );
+                break;
+            case kRotateOperation:
+            case kRotateXOperation:
+            case kRotateYOperation:
+            case kRotateZOperation:
+                m.setAxisAngle( op.getAxis(),
+                                DegreesToRadians( op.getAngle() ) );
+                break;
+            case kMatrixOperation:
+                m = op.getMatrix();
+                break;
+        }
+        ret = m * ret;
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+void matrixTest()
+{
+    std::string fileName = "getMatrixXform.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), fileName );
+        OXform a( OObject( archive, kTop ), "a" );
+        OXform b( OObject( archive, kTop ), "b" );
+        OXform c( OObject( archive, kTop ), "c" );
+
+        M44d mat;
+        mat.setEulerAngles( V3d( 0.1, 0.2, 0.3 ) );
+        for ( size_t i = 0; i < 10; ++i )
+        {
+            double t = (double)i;
+
+            XformSample aSamp;
+            aSamp.addOp( XformOp( kTranslateOperation ),
+                         V3d( t, -2.0 * t, 0.5 ) );
+            aSamp.addOp( XformOp( kRotateOperation ),
+                         V3d( 0.3, 1.0, -0.2 ), 7.0 * t );
+            aSamp.addOp( XformOp( kRotateXOperation ), 15.0 + t );
+            aSamp.addOp( XformOp( kMatrixOperation ), mat );
+            aSamp.addOp( XformOp( kRotateZOperation ), -3.0 * t );
+            aSamp.addOp( XformOp( kScaleOperation ), V3d( 1.0 + t, 2.0, 0.5 ) );
+            aSamp.addOp( XformOp( kTranslateOperation ), V3d( 0.0, t, 1.0 ) );
+            aSamp.addOp( XformOp( kRotateYOperation ), 90.0 );
+            aSamp.setInheritsXforms( i % 2 == 0 );
+            a.getSchema().set( aSamp );
+
+            // no ops at all
+            XformSample bSamp;
+            b.getSchema().set( bSamp );
+        }
+
+        XformSample cSamp;
+        cSamp.addOp( XformOp( kScaleOperation ), V3d( 2.0, 3.0, 4.0 ) );
+        cSamp.addOp( XformOp( kRotateYOperation ), 30.0 );
+        c.getSchema().set( cSamp );
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), fileName );
+        IXformSchema a = IXform( IObject( archive, kTop ), "a" ).getSchema();
+        IXformSchema b = IXform( IObject( archive, kTop ), "b" ).getSchema();
+        IXformSchema c = IXform( IObject( archive, kTop ), "c" ).getSchema();
+
+        std::vector< Abc::ISampleSelector > sels;
+        for ( index_t i = 0; i < 10; ++i )
+        {
+            Abc::ISampleSelector ss( i );
+            XformSample samp = a.getValue( ss );
+            M44d ref = referenceMatrix( samp );
+            TESTING_ASSERT( samp.getMatrix() == ref );
+            TESTING_ASSERT( a.getMatrix( ss ) == ref );
+            TESTING_ASSERT( a.getInheritsXforms( ss ) == ( i % 2 == 0 ) );
+
+            TESTING_ASSERT( b.getMatrix( ss ) == M44d() );
+
+            // repeat some samples and go backwards
+            sels.push_back( Abc::ISampleSelector( 9 - i ) );
+            sels.push_back( Abc::ISampleSelector( 9 - i ) );
+        }
+
+        std::vector< M44d > mats;
+        a.getMatrices( sels, mats );
+        TESTING_ASSERT( mats.size() == sels.size() );
+        for ( size_t i = 0; i < sels.size(); ++i )
+        {
+            TESTING_ASSERT( mats[i] == a.getValue( sels[i] ).getMatrix() );
+        }
+
+        b.getMatrices( sels, mats );
+        for ( size_t i = 0; i < mats.size(); ++i )
+        {
+            TESTING_ASSERT( mats[i] == M44d() );
+        }
+
+        c.getMatrices( sels, mats );
+        M44d cRef = referenceMatrix( c.getValue() );
+        TESTING_ASSERT( c.getMatrix() == cRef );
+        for ( size_t i = 0; i < mats.size(); ++i )
+        {
+            TESTING_ASSERT( mats[i] == cRef );
+        }
+
+        sels.clear();
+        a.getMatrices( sels, mats );
+        TESTING_ASSERT( mats.empty() );
+    }
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -133,5 +258,7 @@ int main( int argc, char *argv[] )
 
     rotateTest();
 
+    matrixTest();
+
     return 0;
 }
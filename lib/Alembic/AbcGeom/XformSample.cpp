@@ -552,65 +552,156 @@ Abc::M44d XformSample::getMatrix() const
     Abc::M44d ret;
     ret.makeIdentity();
 
+    double channels[16];
+    const double * channelPtrs[16];
+
     for ( std::size_t i = 0 ; i < m_ops.size() ; ++i )
     {
-        Abc::M44d m;
-        m.makeIdentity();
+        const XformOp & op = m_ops[i];
 
-        XformOp op = m_ops[i];
+        std::size_t numChannels = op.getNumChannels();
+        for ( std::size_t j = 0 ; j < numChannels ; ++j )
+        {
+            channels[j] = op.getChannelValue( j );
+            channelPtrs[j] = &channels[j];
+        }
 
-        XformOperationType otype = op.getType();
+        applyOp( op.getType(), channelPtrs, 1, &ret, i == 0 );
+    }
+
+    return ret;
+}
 
-        if ( otype == kMatrixOperation )
+//-*****************************************************************************
+// Each op only touches the parts of the matrix it has to.  The sums are
+// done in the same order as a full M44d multiply and the terms that are
+// skipped would all have been exactly zero, so the result is the same as
+// multiplying by the op's matrix.
+void XformSample::applyOp( XformOperationType iType,
+                           const double * const * iChannels,
+                           std::size_t iNumMatrices,
+                           Abc::M44d * ioMatrices,
+                           bool iIdentity )
+{
+    if ( iType == kScaleOperation )
+    {
+        const double * sx = iChannels[0];
+        const double * sy = iChannels[1];
+        const double * sz = iChannels[2];
+        for ( std::size_t i = 0 ; i < iNumMatrices ; ++i )
         {
-            for ( std::size_t j = 0 ; j < 4 ; ++j )
+            Abc::M44d & m = ioMatrices[i];
+            if ( iIdentity )
             {
-                for ( std::size_t k = 0 ; k < 4 ; ++k )
-                {
-                    m.x[j][k] = op.getChannelValue( ( 4 * j ) + k );
-                }
+                m.setScale( Abc::V3d( sx[i], sy[i], sz[i] ) );
+                continue;
+            }
+
+            for ( std::size_t k = 0 ; k < 4 ; ++k )
+            {
+                m.x[0][k] *= sx[i];
+                m.x[1][k] *= sy[i];
+                m.x[2][k] *= sz[i];
             }
         }
-        else if ( otype == kRotateXOperation )
-        {
-            m.setAxisAngle( Abc::V3d( 1.0, 0.0, 0.0 ),
-                            DegreesToRadians( op.getChannelValue( 0 ) ) );
-        }
-        else if ( otype == kRotateYOperation )
+    }
+    else if ( iType == kTranslateOperation )
+    {
+        const double * tx = iChannels[0];
+        const double * ty = iChannels[1];
+        const double * tz = iChannels[2];
+        for ( std::size_t i = 0 ; i < iNumMatrices ; ++i )
         {
-            m.setAxisAngle( Abc::V3d( 0.0, 1.0, 0.0 ),
-                            DegreesToRadians( op.getChannelValue( 0 ) ) );
+            Abc::M44d & m = ioMatrices[i];
+            if ( iIdentity )
+            {
+                m.setTranslation( Abc::V3d( tx[i], ty[i], tz[i] ) );
+                continue;
+            }
+
+            for ( std::size_t k = 0 ; k < 4 ; ++k )
+            {
+                m.x[3][k] = tx[i] * m.x[0][k] + ty[i] * m.x[1][k] +
+                    tz[i] * m.x[2][k] + m.x[3][k];
+            }
         }
-        else if ( otype == kRotateZOperation )
+    }
+    else if ( iType == kMatrixOperation )
+    {
+        for ( std::size_t i = 0 ; i < iNumMatrices ; ++i )
         {
-            m.setAxisAngle( Abc::V3d( 0.0, 0.0, 1.0 ),
-                            DegreesToRadians( op.getChannelValue( 0 ) ) );
+            Abc::M44d op;
+            for ( std::size_t j = 0 ; j < 4 ; ++j )
+            {
+                for ( std::size_t k = 0 ; k < 4 ; ++k )
+                {
+                    op.x[j][k] = iChannels[( 4 * j ) + k][i];
+                }
+            }
+
+            if ( iIdentity )
+            {
+                ioMatrices[i] = op;
+            }
+            else
+            {
+                ioMatrices[i] = op * ioMatrices[i];
+            }
         }
-        else
+    }
+    else
+    {
+        // all of the rotations only touch the upper 3x3
+        for ( std::size_t i = 0 ; i < iNumMatrices ; ++i )
         {
-            Abc::V3d vec( op.getChannelValue( 0 ),
-                          op.getChannelValue( 1 ),
-                          op.getChannelValue( 2 ) );
-
-            if ( otype == kScaleOperation )
+            Abc::M44d rot;
+            if ( iType == kRotateXOperation )
+            {
+                rot.setAxisAngle( Abc::V3d( 1.0, 0.0, 0.0 ),
+                                  DegreesToRadians( iChannels[0][i] ) );
+            }
+            else if ( iType == kRotateYOperation )
             {
-                m.setScale( vec );
+                rot.setAxisAngle( Abc::V3d( 0.0, 1.0, 0.0 ),
+                                  DegreesToRadians( iChannels[0][i] ) );
             }
-            else if ( otype == kTranslateOperation )
+            else if ( iType == kRotateZOperation )
             {
-                m.setTranslation( vec );
+                rot.setAxisAngle( Abc::V3d( 0.0, 0.0, 1.0 ),
+                                  DegreesToRadians( iChannels[0][i] ) );
             }
-            else if ( otype == kRotateOperation )
+            else if ( iType == kRotateOperation )
             {
-                m.setAxisAngle( vec,
-                                DegreesToRadians( op.getChannelValue( 3 ) ) );
+                rot.setAxisAngle( Abc::V3d( iChannels[0][i], iChannels[1][i],
+                                            iChannels[2][i] ),
+                                  DegreesToRadians( iChannels[3][i] ) );
+            }
+            else
+            {
+                continue;
             }
 
+            Abc::M44d & m = ioMatrices[i];
+            if ( iIdentity )
+            {
+                m = rot;
+                continue;
+            }
+
+            for ( std::size_t k = 0 ; k < 4 ; ++k )
+            {
+                double r0 = m.x[0][k];
+                double r1 = m.x[1][k];
+                double r2 = m.x[2][k];
+                m.x[0][k] = rot.x[0][0] * r0 + rot.x[0][1] * r1 +
+                    rot.x[0][2] * r2;
+                m.x[1][k] = rot.x[1][0] * r0 + rot.x[1][1] * r1 +
+                    rot.x[1][2] * r2;
+                m.x[2][k] = rot.x[2][0] * r0 + rot.x[2][1] * r1 +
+                    rot.x[2][2] * r2;
+            }
         }
-        ret = m * ret;
     }
-
-    return ret;
 }
 
 //-*****************************************************************************
@@ -132,6 +132,16 @@ private:
     const std::vector<Alembic::Util::uint8_t> &getOpsArray() const;
     void clear();
 
+    //! Premultiplies each of the iNumMatrices ioMatrices by the matrix of an
+    //! op of type iType.  The channels are laid out one array per channel,
+    //! iChannels[c][i] is channel c of the op for matrix i.  If iIdentity
+    //! is true ioMatrices are all identity and just get overwritten.
+    static void applyOp( XformOperationType iType,
+                         const double * const * iChannels,
+                         std::size_t iNumMatrices,
+                         Abc::M44d * ioMatrices,
+                         bool iIdentity );
+
 
 private:
     //! 0 is unset; 1 is set via addOp; 2 is set via non-op-based methods
@@ -51,6 +51,20 @@ IArchive::IArchive(const std::vector< std::istream * > & iStreams) :
     init();
 }
 
+IArchive::IArchive(const std::string & iFileName,
+                   Alembic::Util::int32_t iFileDescriptor,
+                   std::size_t iNumStreams) :
+    mStreams(new IStreams(iFileName, iFileDescriptor, iNumStreams))
+{
+    init();
+}
+
+IArchive::IArchive(const void * iBuffer, std::size_t iSize) :
+    mStreams(new IStreams(iBuffer, iSize))
+{
+    init();
+}
+
 void IArchive::init()
 {
     if (mStreams->isValid())
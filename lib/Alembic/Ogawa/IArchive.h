@@ -52,6 +52,15 @@ class ALEMBIC_EXPORT IArchive
 public:
     IArchive(const std::string & iFileName, std::size_t iNumStreams=1);
     IArchive(const std::vector< std::istream * > & iStreams);
+
+    // read from iFileName which is already open as iFileDescriptor, which we
+    // take ownership of, see IStreams
+    IArchive(const std::string & iFileName,
+             Alembic::Util::int32_t iFileDescriptor,
+             std::size_t iNumStreams);
+
+    // read from an archive already in memory, see IStreams
+    IArchive(const void * iBuffer, std::size_t iSize);
     ~IArchive();
 
     bool isValid() const;
@@ -183,6 +183,11 @@ bool IGroup::isLight() const
     return mData->numChildren != 0 && mData->childVec.empty();
 }
 
+Alembic::Util::uint64_t IGroup::getPos() const
+{
+    return mData->pos;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
@@ -68,6 +68,8 @@ public:
 
     bool isLight() const;
 
+    Alembic::Util::uint64_t getPos() const;
+
 private:
     friend class IArchive;
     IGroup(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos, bool iLight,
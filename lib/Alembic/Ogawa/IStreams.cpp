@@ -36,6 +36,7 @@
 #include <Alembic/Ogawa/IStreams.h>
 #include <fstream>
 #include <stdexcept>
+#include <cstring>
 
 #include <fcntl.h>
 
@@ -86,6 +87,8 @@ public:
         }
 
         fd = -1;
+        buffer = NULL;
+        bufferSize = 0;
         isGood = true;
     }
 
@@ -95,6 +98,19 @@ public:
         offset = 0;
 
         fd = iFileDescriptor;
+        buffer = NULL;
+        bufferSize = 0;
+        isGood = true;
+    }
+
+    IStream(const char * iBuffer, Alembic::Util::uint64_t iSize)
+    {
+        stream = NULL;
+        offset = 0;
+
+        fd = -1;
+        buffer = iBuffer;
+        bufferSize = iSize;
         isGood = true;
     }
 
@@ -117,6 +133,19 @@ public:
             return;
         }
 
+        if (buffer)
+        {
+            if (offset > bufferSize || iSize > bufferSize - offset)
+            {
+                isGood = false;
+                return;
+            }
+
+            memcpy(oBuf, buffer + offset, iSize);
+            offset += iSize;
+            return;
+        }
+
         Alembic::Util::uint64_t totalRead = 0;
         void * buf = oBuf;
 
@@ -197,6 +226,8 @@ private:
     std::istream * stream;
 
     Alembic::Util::int32_t fd;
+    const char * buffer;
+    Alembic::Util::uint64_t bufferSize;
     Alembic::Util::uint64_t offset;
     bool isGood;
 };
@@ -211,6 +242,8 @@ public:
         frozen = false;
         version = 0;
         fid = -1;
+        buffer = NULL;
+        bufferSize = 0;
     }
 
     ~PrivateData()
@@ -234,14 +267,34 @@ public:
     Alembic::Util::uint16_t version;
 
     Alembic::Util::int32_t fid;
+
+    // set when reading from memory
+    const char * buffer;
+    Alembic::Util::uint64_t bufferSize;
 };
 
 IStreams::IStreams(const std::string & iFileName, std::size_t iNumStreams) :
     mData(new IStreams::PrivateData())
 {
-
     mData->fid = OPENFILE(iFileName.c_str(), O_RDONLY);
+    initFileStreams(iNumStreams);
+}
+
+IStreams::IStreams(const std::string & iFileName,
+                   Alembic::Util::int32_t iFileDescriptor,
+                   std::size_t iNumStreams) :
+    mData(new IStreams::PrivateData())
+{
+    mData->fid = iFileDescriptor;
+    if (mData->fid < 0)
+    {
+        mData->fid = OPENFILE(iFileName.c_str(), O_RDONLY);
+    }
+    initFileStreams(iNumStreams);
+}
 
+void IStreams::initFileStreams(std::size_t iNumStreams)
+{
     if (mData->fid > -1)
     {
         mData->streams.push_back(IStream(mData->fid));
@@ -286,6 +339,27 @@ IStreams::IStreams(const std::vector< std::istream * > & iStreams) :
     mData->locks = new Alembic::Util::mutex[mData->streams.size()];
 }
 
+IStreams::IStreams(const void * iBuffer, std::size_t iSize) :
+    mData(new IStreams::PrivateData())
+{
+    if (iBuffer != NULL)
+    {
+        mData->streams.push_back(
+            IStream(static_cast< const char * >(iBuffer), iSize));
+    }
+
+    init();
+    if (!mData->valid || mData->version != 1)
+    {
+        mData->streams.clear();
+        return;
+    }
+
+    mData->buffer = static_cast< const char * >(iBuffer);
+    mData->bufferSize = iSize;
+    mData->locks = new Alembic::Util::mutex[mData->streams.size()];
+}
+
 void IStreams::init()
 {
     // simple temporary endian check
@@ -342,7 +416,10 @@ void IStreams::init()
             return;
         }
     }
-    mData->valid = true;
+
+    // only version 1 can be read, anything else gets its streams cleared
+    // so it must not be treated as valid
+    mData->valid = (mData->version == 1);
 }
 
 IStreams::~IStreams()
@@ -372,6 +449,19 @@ void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
         return;
     }
 
+    // nothing to seek, so every thread can copy straight out of the buffer
+    if (mData->buffer)
+    {
+        if (iPos > mData->bufferSize || iSize > mData->bufferSize - iPos)
+        {
+            throw std::runtime_error(
+                "Ogawa IStreams::read failed.");
+        }
+
+        memcpy(oBuf, mData->buffer + iPos, iSize);
+        return;
+    }
+
     std::size_t threadId = 0;
     if (iThreadId < mData->streams.size())
     {
@@ -50,6 +50,21 @@ class ALEMBIC_EXPORT IStreams
 public:
     IStreams(const std::string & iFileName, std::size_t iNumStreams=1);
     IStreams(const std::vector< std::istream * > & iStreams);
+
+    // Read from iFileName which has already been opened for reading as
+    // iFileDescriptor, we take ownership of it and close it when we are done
+    // (or right away if it isn't a valid Ogawa file).  Reads never depend on
+    // the current position of the file descriptor.
+    // If iFileDescriptor is -1 iFileName is opened instead.
+    IStreams(const std::string & iFileName,
+             Alembic::Util::int32_t iFileDescriptor,
+             std::size_t iNumStreams);
+
+    // Read directly out of an Ogawa archive which is already in memory.
+    // The buffer is not copied, is not owned, and needs to stay valid (and
+    // unchanged) for as long as anything reads from it.
+    // Reads from a buffer don't need to seek, so they never lock.
+    IStreams(const void * iBuffer, std::size_t iSize);
     ~IStreams();
 
     bool isValid();
@@ -66,6 +81,7 @@ private:
     const IStreams & operator=(const IStreams &);
 
     void init();
+    void initFileStreams(std::size_t iNumStreams);
 
     class PrivateData;
     Alembic::Util::unique_ptr< PrivateData > mData;
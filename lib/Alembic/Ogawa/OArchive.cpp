@@ -47,11 +47,22 @@ OArchive::OArchive(const std::string & iFileName) :
     mGroup.reset(new OGroup(mStream));
 }
 
+OArchive::OArchive(const std::string & iFileName, bool iAppend) :
+    mStream(new OStream(iFileName, iAppend))
+{
+    mGroup.reset(new OGroup(mStream));
+}
+
 OArchive::OArchive(std::ostream * iStream) :
     mStream(new OStream(iStream)), mGroup(new OGroup(mStream))
 {
 }
 
+OArchive::OArchive(std::vector< char > * iBuffer) :
+    mStream(new OStream(iBuffer)), mGroup(new OGroup(mStream))
+{
+}
+
 OArchive::~OArchive()
 {
 }
@@ -50,6 +50,18 @@ class ALEMBIC_EXPORT OArchive
 public:
     OArchive(const std::string & iFileName);
     OArchive(std::ostream * iStream);
+
+    // Write the archive into memory at the end of iBuffer, see OStream.
+    // The archive in iBuffer is complete once this has been destroyed.
+    OArchive(std::vector< char > * iBuffer);
+
+    // Open an existing, cleanly closed archive for appending.
+    // Groups and data that are already in the file can be referenced by the
+    // new root group via OGroup::addGroup(IGroupPtr) and
+    // OGroup::addData(IDataPtr).  The position of the new root group is only
+    // written to the header once it is frozen, so until then the file still
+    // reads as the old archive.
+    OArchive(const std::string & iFileName, bool iAppend);
     ~OArchive();
 
     OGroupPtr getGroup();
@@ -212,6 +212,36 @@ void OGroup::addGroup(OGroupPtr iGroup)
     }
 }
 
+void OGroup::addGroup(IGroupPtr iGroup)
+{
+    if (!isFrozen())
+    {
+        mData->childVec.push_back(iGroup->getPos());
+    }
+}
+
+ODataPtr OGroup::addData(IDataPtr iData)
+{
+    ODataPtr child;
+    if (isFrozen())
+    {
+        return child;
+    }
+
+    if (iData->getPos() == 0)
+    {
+        child.reset(new OData());
+    }
+    else
+    {
+        child.reset(new OData(mData->stream, iData->getPos(),
+                              iData->getSize()));
+    }
+
+    mData->childVec.push_back(child->getPos() | 0x8000000000000000ULL);
+    return child;
+}
+
 void OGroup::addEmptyGroup()
 {
     if (!isFrozen())
@@ -40,6 +40,8 @@
 #include <Alembic/Ogawa/Foundation.h>
 #include <Alembic/Ogawa/OStream.h>
 #include <Alembic/Ogawa/OData.h>
+#include <Alembic/Ogawa/IGroup.h>
+#include <Alembic/Ogawa/IData.h>
 
 namespace Alembic {
 namespace Ogawa {
@@ -85,6 +87,14 @@ public:
     // reference an existing group
     void addGroup(OGroupPtr iGroup);
 
+    // reference a group that was already in the file when it was opened
+    // for appending
+    void addGroup(IGroupPtr iGroup);
+
+    // reference data that was already in the file when it was opened for
+    // appending, the returned ODataPtr can be used to reference it again
+    ODataPtr addData(IDataPtr iData);
+
     // convenience function for adding a default NULL group
     void addEmptyGroup();
 
@@ -36,6 +36,8 @@
 #include <Alembic/Ogawa/OStream.h>
 #include <fstream>
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
 
 namespace Alembic {
 namespace Ogawa {
@@ -45,7 +47,8 @@ class OStream::PrivateData
 {
 public:
     PrivateData(const std::string & iFileName) :
-        stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0)
+        stream(NULL), memory(NULL), fileName(iFileName), startPos(0),
+        curPos(0), maxPos(0), memoryPos(0), append(false)
     {
         std::ofstream * filestream = new std::ofstream(fileName.c_str(),
             std::ios_base::trunc | std::ios_base::binary);
@@ -65,8 +68,44 @@ public:
         }
     }
 
+    PrivateData(const std::string & iFileName, bool iAppend) :
+        stream(NULL), memory(NULL), fileName(iFileName), startPos(0),
+        curPos(0), maxPos(0), memoryPos(0), append(iAppend)
+    {
+        // opening for both input and output keeps the existing contents
+        std::fstream * filestream = new std::fstream(fileName.c_str(),
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+
+        char header[16] = {0};
+        if (filestream->is_open())
+        {
+            filestream->read(header, sizeof(header));
+        }
+
+        // we only append to files which were completely written
+        if (filestream->is_open() && filestream->gcount() == sizeof(header) &&
+            std::string(header, 5) == "Ogawa" && header[5] == char(0xff))
+        {
+            stream = filestream;
+#if defined _WIN32 || defined _WIN64
+            filestream->rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+#endif
+            filestream->seekp(0, std::ios_base::end);
+            maxPos = filestream->tellp();
+            curPos = maxPos;
+            stream->exceptions ( std::ostream::failbit |
+                                 std::ostream::badbit );
+        }
+        else
+        {
+            filestream->close();
+            delete filestream;
+        }
+    }
+
     PrivateData(std::ostream * iStream) :
-        stream(iStream), startPos(0), curPos(0), maxPos(0)
+        stream(iStream), memory(NULL), startPos(0), curPos(0), maxPos(0),
+        memoryPos(0), append(false)
     {
         if (stream)
         {
@@ -81,28 +120,85 @@ public:
         }
     }
 
+    PrivateData(std::vector< char > * iMemory) :
+        stream(NULL), memory(iMemory), startPos(0), curPos(0), maxPos(0),
+        memoryPos(0), append(false)
+    {
+        if (memory)
+        {
+            startPos = memory->size();
+            memoryPos = startPos;
+        }
+    }
+
     ~PrivateData()
     {
         // if this was done via file, try to clean it up
         if (!fileName.empty() && stream)
         {
             std::ofstream * filestream = dynamic_cast<std::ofstream *>(stream);
+            std::fstream * appendstream = dynamic_cast<std::fstream *>(stream);
             if (filestream)
             {
                 filestream->close();
                 delete filestream;
             }
+            else if (appendstream)
+            {
+                appendstream->close();
+                delete appendstream;
+            }
         }
     }
 
+    // seeks to the absolute position iPos
+    void seekp(Alembic::Util::uint64_t iPos)
+    {
+        if (memory)
+        {
+            memoryPos = iPos;
+            return;
+        }
+
+        stream->seekp(iPos);
+    }
+
+    void write(const char * iBuf, Alembic::Util::uint64_t iSize)
+    {
+        if (!memory)
+        {
+            stream->write(iBuf, iSize).flush();
+            return;
+        }
+
+        // overwrite what is already there, and append the rest
+        std::size_t overlap = 0;
+        if (memoryPos < memory->size())
+        {
+            overlap = std::min< std::size_t >(memory->size() - memoryPos,
+                                              iSize);
+            memcpy(&(*memory)[memoryPos], iBuf, overlap);
+        }
+        else if (memoryPos > memory->size())
+        {
+            memory->resize(memoryPos);
+        }
+
+        memory->insert(memory->end(), iBuf + overlap, iBuf + iSize);
+        memoryPos += iSize;
+    }
+
 #if defined _WIN32 || defined _WIN64
     char buffer [STREAM_BUF_SIZE];
 #endif
     std::ostream * stream;
+    std::vector< char > * memory;
     std::string fileName;
     Alembic::Util::uint64_t startPos;
     Alembic::Util::uint64_t curPos;
     Alembic::Util::uint64_t maxPos;
+    Alembic::Util::uint64_t memoryPos;
+    bool append;
     Alembic::Util::mutex lock;
 };
 
@@ -112,25 +208,40 @@ OStream::OStream(const std::string & iFileName) :
     init();
 }
 
+OStream::OStream(const std::string & iFileName, bool iAppend) :
+    mData(iAppend ? new PrivateData(iFileName, iAppend) :
+                    new PrivateData(iFileName))
+{
+    init();
+}
+
 // we'll be writing from this already open stream which we don't own
 OStream::OStream(std::ostream * iStream) : mData(new PrivateData(iStream))
 {
     init();
 }
 
+// we'll be writing into this buffer which we don't own
+OStream::OStream(std::vector< char > * iBuffer) :
+    mData(new PrivateData(iBuffer))
+{
+    init();
+}
+
 OStream::~OStream()
 {
     // write our "frozen" byte (totally done writing)
     if (isValid())
     {
         char frozen = 0xff;
-        mData->stream->seekp(mData->startPos + 5).write(&frozen, 1).flush();
+        mData->seekp(mData->startPos + 5);
+        mData->write(&frozen, 1);
     }
 }
 
 bool OStream::isValid()
 {
-    return mData->stream != NULL;
+    return mData->stream != NULL || mData->memory != NULL;
 }
 
 void OStream::init()
@@ -149,14 +260,15 @@ void OStream::init()
             "Ogawa currently only supports little-endian writing.");
     }
 
-    if (isValid())
+    // the header is already there, and stays frozen while we append
+    if (isValid() && !mData->append)
     {
         const char header[] = {
             'O', 'g', 'a', 'w', 'a',  // special magic number
             0,       // this will be 0xff when the entire archive is done
             0, 1,    // 16 bit format version number
             0, 0, 0, 0, 0, 0, 0, 0}; // position of the first group
-        mData->stream->write(header, sizeof(header)).flush();
+        mData->write(header, sizeof(header));
         mData->curPos += sizeof(header);
         if( mData->curPos > mData->maxPos )
         {
@@ -172,7 +284,7 @@ Alembic::Util::uint64_t OStream::getAndSeekEndPos()
         Alembic::Util::scoped_lock l(mData->lock);
 
         mData->curPos = mData->maxPos;
-        mData->stream->seekp(mData->curPos + mData->startPos);
+        mData->seekp(mData->curPos + mData->startPos);
         return mData->curPos;
     }
     return 0;
@@ -183,7 +295,7 @@ void OStream::seek(Alembic::Util::uint64_t iPos)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->seekp(iPos + mData->startPos);
+        mData->seekp(iPos + mData->startPos);
         mData->curPos = iPos;
     }
 }
@@ -193,7 +305,7 @@ void OStream::write(const void * iBuf, Alembic::Util::uint64_t iSize)
     if (isValid())
     {
         Alembic::Util::scoped_lock l(mData->lock);
-        mData->stream->write((const char *)iBuf, iSize).flush();
+        mData->write((const char *)iBuf, iSize);
         mData->curPos += iSize;
         if(mData->curPos > mData->maxPos)
         {
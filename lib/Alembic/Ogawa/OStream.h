@@ -40,6 +40,7 @@
 #include <Alembic/Ogawa/Foundation.h>
 
 #include <ostream>
+#include <vector>
 
 #if defined _WIN32 || defined _WIN64
     #define STREAM_BUF_SIZE 1024*1024*2
@@ -53,7 +54,17 @@ class ALEMBIC_EXPORT OStream
 {
 public:
     OStream(const std::string & iFileName);
+
+    // open an existing, cleanly closed Ogawa file so that more data can be
+    // written past the end of it, nothing already in the file is changed
+    // until the root group is rewritten
+    OStream(const std::string & iFileName, bool iAppend);
     OStream(std::ostream * iStream);
+
+    // Write into memory, starting at the current end of iBuffer.
+    // The buffer grows as needed, isn't owned, and holds the complete archive
+    // once this has been destroyed.  Nothing is flushed or copied in between.
+    OStream(std::vector< char > * iBuffer);
     ~OStream();
 
     bool isValid();
@@ -36,6 +36,7 @@
 
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+#include <fstream>
 
 void test()
 {
@@ -55,6 +56,14 @@ void test()
     TESTING_ASSERT(ia.getVersion() == 1);
     TESTING_ASSERT(ia.getGroup()->getNumChildren() == 0);
 
+    // no file descriptor yet, so it opens the file itself
+    Alembic::Ogawa::IArchive ib("archiveTest.ogawa", -1, 2);
+    TESTING_ASSERT(ib.isValid());
+    TESTING_ASSERT(ib.isFrozen());
+    TESTING_ASSERT(ib.getGroup()->getNumChildren() == 0);
+
+    Alembic::Ogawa::IArchive missing("archiveTestMissing.ogawa", -1, 1);
+    TESTING_ASSERT(!missing.isValid());
 }
 
 void stringStreamTest()
@@ -77,9 +86,116 @@ void stringStreamTest()
     TESTING_ASSERT(ia.getGroup()->getNumChildren() == 0);
 }
 
+void memoryTest()
+{
+    std::vector< char > buffer(7, 'x');
+    {
+        Alembic::Ogawa::OArchive oa(&buffer);
+        TESTING_ASSERT(oa.isValid());
+        Alembic::Ogawa::OGroupPtr child = oa.getGroup()->addGroup();
+        char data[] = {0, 1, 2, 3};
+        child->addData(4, data);
+        oa.getGroup()->addData(2, data);
+    }
+
+    // the archive starts after what was already in the buffer
+    TESTING_ASSERT(buffer.size() > 23);
+    TESTING_ASSERT(std::string(&buffer[0], 7) == "xxxxxxx");
+
+    Alembic::Ogawa::IArchive ia(&buffer[7], buffer.size() - 7);
+    TESTING_ASSERT(ia.isValid());
+    TESTING_ASSERT(ia.isFrozen());
+    TESTING_ASSERT(ia.getVersion() == 1);
+
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    TESTING_ASSERT(top->getNumChildren() == 2);
+    TESTING_ASSERT(top->getGroup(0, false, 0)->getNumChildren() == 1);
+
+    char readData[4] = {0, 0, 0, 0};
+    top->getGroup(0, false, 0)->getData(0, 0)->read(4, readData, 0, 0);
+    TESTING_ASSERT(readData[0] == 0 && readData[3] == 3);
+    top->getData(1, 0)->read(2, readData, 0, 0);
+    TESTING_ASSERT(readData[1] == 1);
+
+    // just the header, the root group is past the end of the buffer
+    TESTING_ASSERT_THROW(Alembic::Ogawa::IArchive(&buffer[7], 16),
+                         std::runtime_error);
+
+    // not an Ogawa buffer
+    Alembic::Ogawa::IArchive junk(&buffer[0], buffer.size());
+    TESTING_ASSERT(!junk.isValid());
+
+    Alembic::Ogawa::IArchive empty(NULL, 0);
+    TESTING_ASSERT(!empty.isValid());
+}
+
+void appendTest()
+{
+    char data[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    {
+        Alembic::Ogawa::OArchive oa("appendTest.ogawa");
+        Alembic::Ogawa::OGroupPtr child = oa.getGroup()->addGroup();
+        child->addData(4, data);
+        child->addEmptyData();
+        oa.getGroup()->addData(2, data);
+    }
+
+    // keep the original open while appending to it
+    Alembic::Ogawa::IArchive orig("appendTest.ogawa");
+    TESTING_ASSERT(orig.isValid());
+    TESTING_ASSERT(orig.getGroup()->getNumChildren() == 2);
+
+    {
+        Alembic::Ogawa::OArchive oa("appendTest.ogawa", true);
+        TESTING_ASSERT(oa.isValid());
+        Alembic::Ogawa::IArchive ia("appendTest.ogawa");
+        Alembic::Ogawa::IGroupPtr oldTop = ia.getGroup();
+
+        // the old root is still the one we read until the new one is frozen
+        TESTING_ASSERT(ia.isFrozen());
+        TESTING_ASSERT(oldTop->getNumChildren() == 2);
+
+        Alembic::Ogawa::OGroupPtr top = oa.getGroup();
+        top->addGroup(oldTop->getGroup(0, false, 0));
+        Alembic::Ogawa::ODataPtr od = top->addData(oldTop->getData(1, 0));
+        TESTING_ASSERT(od->getSize() == 2);
+        top->addData(od);
+        top->addData(8, data);
+    }
+
+    Alembic::Ogawa::IArchive ia("appendTest.ogawa");
+    TESTING_ASSERT(ia.isValid());
+    TESTING_ASSERT(ia.isFrozen());
+    Alembic::Ogawa::IGroupPtr top = ia.getGroup();
+    TESTING_ASSERT(top->getNumChildren() == 4);
+
+    Alembic::Ogawa::IGroupPtr child = top->getGroup(0, false, 0);
+    TESTING_ASSERT(child->getNumChildren() == 2);
+    TESTING_ASSERT(child->getData(0, 0)->getSize() == 4);
+    TESTING_ASSERT(child->isEmptyChildData(1));
+
+    char readData[8];
+    top->getData(1, 0)->read(2, readData, 0, 0);
+    TESTING_ASSERT(readData[0] == 0 && readData[1] == 1);
+    TESTING_ASSERT(top->getData(1, 0)->getPos() ==
+                   top->getData(2, 0)->getPos());
+    top->getData(3, 0)->read(8, readData, 0, 0);
+    TESTING_ASSERT(readData[7] == 7);
+
+    // a file that isn't Ogawa can't be appended to
+    {
+        std::ofstream junk("appendJunk.ogawa");
+        junk << "potato!";
+    }
+    Alembic::Ogawa::OArchive junk("appendJunk.ogawa", true);
+    TESTING_ASSERT(!junk.isValid());
+}
+
 int main ( int argc, char *argv[] )
 {
     test();
     stringStreamTest();
+    memoryTest();
+    appendTest();
     return 0;
 }
\ No newline at end of file
@@ -38,6 +38,7 @@
 
 #include <Alembic/Util/Export.h>
 #include <Alembic/Util/Foundation.h>
+#include <Alembic/Util/Compress.h>
 #include <Alembic/Util/Digest.h>
 #include <Alembic/Util/Dimensions.h>
 #include <Alembic/Util/Exception.h>
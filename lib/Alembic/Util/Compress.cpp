@@ -0,0 +1,373 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Compress.h>
+#include <Alembic/Util/Exception.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// The compressed buffer is one byte with the shuffle size (0 when not
+// shuffled) followed by a sequence of:
+//
+// token, literal length bytes, literals, offset, match length bytes
+//
+// The high 4 bits of the token are the number of literals and the low 4 bits
+// are the match length minus MIN_MATCH.  A value of 15 in either means 255
+// valued bytes follow, until a byte which isn't 255, and they are all added
+// to the length.  The offset is 2 bytes, little endian, and counts back from
+// the current output position.  The last sequence only has literals.
+//-*****************************************************************************
+
+namespace {
+
+const std::size_t MIN_MATCH = 4;
+
+// don't let matches run into the last few bytes, and don't start looking
+// for them too close to the end
+const std::size_t LAST_LITERALS = 5;
+const std::size_t MATCH_FIND_LIMIT = 12;
+
+const std::size_t MAX_OFFSET = 65535;
+
+inline uint32_t read32( const uint8_t * iPtr )
+{
+    uint32_t val;
+    memcpy( &val, iPtr, 4 );
+    return val;
+}
+
+inline uint32_t hash32( uint32_t iVal, int iBits )
+{
+    return ( iVal * 2654435761U ) >> ( 32 - iBits );
+}
+
+void pushLength( std::vector< uint8_t > & oBuf, std::size_t iLength )
+{
+    while ( iLength >= 255 )
+    {
+        oBuf.push_back( 255 );
+        iLength -= 255;
+    }
+    oBuf.push_back( ( uint8_t ) iLength );
+}
+
+// iMatchLength of 0 is the last sequence, which only has literals
+void pushSequence( std::vector< uint8_t > & oBuf, const uint8_t * iLiterals,
+                   std::size_t iNumLiterals, std::size_t iOffset,
+                   std::size_t iMatchLength )
+{
+    std::size_t tokenPos = oBuf.size();
+    uint8_t token = 0;
+    oBuf.push_back( token );
+
+    if ( iNumLiterals >= 15 )
+    {
+        token = 15 << 4;
+        pushLength( oBuf, iNumLiterals - 15 );
+    }
+    else
+    {
+        token = ( uint8_t ) ( iNumLiterals << 4 );
+    }
+
+    oBuf.insert( oBuf.end(), iLiterals, iLiterals + iNumLiterals );
+
+    if ( iMatchLength != 0 )
+    {
+        oBuf.push_back( ( uint8_t ) ( iOffset & 0xff ) );
+        oBuf.push_back( ( uint8_t ) ( iOffset >> 8 ) );
+
+        std::size_t matchLength = iMatchLength - MIN_MATCH;
+        if ( matchLength >= 15 )
+        {
+            token |= 15;
+            pushLength( oBuf, matchLength - 15 );
+        }
+        else
+        {
+            token |= ( uint8_t ) matchLength;
+        }
+    }
+
+    oBuf[tokenPos] = token;
+}
+
+std::size_t readLength( const uint8_t * & ioPtr, const uint8_t * iEnd )
+{
+    std::size_t length = 0;
+    uint8_t val = 255;
+    while ( val == 255 )
+    {
+        if ( ioPtr >= iEnd )
+        {
+            ABC_THROW( "Compressed data ended while reading a length." );
+        }
+        val = *ioPtr++;
+        length += val;
+    }
+    return length;
+}
+
+}
+
+//-*****************************************************************************
+bool Compress( const void * iData, std::size_t iSize, std::size_t iShuffleSize,
+               int iLevel, std::vector< uint8_t > & oBuf )
+{
+    oBuf.clear();
+
+    // too small to bother with, or too big for our 32 bit match table
+    if ( iSize <= MATCH_FIND_LIMIT || iSize > 0xfffffff0 )
+    {
+        return false;
+    }
+
+    const uint8_t * src = static_cast< const uint8_t * >( iData );
+
+    std::vector< uint8_t > shuffled;
+    if ( iShuffleSize > 1 && iShuffleSize < 256 && iSize % iShuffleSize == 0 )
+    {
+        std::size_t numElements = iSize / iShuffleSize;
+        shuffled.resize( iSize );
+        for ( std::size_t b = 0; b < iShuffleSize; ++b )
+        {
+            uint8_t * dst = &shuffled[ b * numElements ];
+            for ( std::size_t i = 0; i < numElements; ++i )
+            {
+                dst[i] = src[ i * iShuffleSize + b ];
+            }
+        }
+        src = &shuffled.front();
+    }
+    else
+    {
+        iShuffleSize = 0;
+    }
+
+    oBuf.reserve( iSize );
+    oBuf.push_back( ( uint8_t ) iShuffleSize );
+
+    if ( iLevel < 0 )
+    {
+        iLevel = 0;
+    }
+    else if ( iLevel > 9 )
+    {
+        iLevel = 9;
+    }
+
+    // positions + 1 of the last time a hash was seen, 0 for never
+    int bits = 12 + iLevel / 2;
+    std::vector< uint32_t > table( std::size_t( 1 ) << bits, 0 );
+
+    const std::size_t matchLimit = iSize - LAST_LITERALS;
+    const std::size_t findLimit = iSize - MATCH_FIND_LIMIT;
+
+    std::size_t anchor = 0;
+    std::size_t pos = 0;
+
+    while ( pos < findLimit )
+    {
+        uint32_t seq = read32( src + pos );
+        uint32_t hash = hash32( seq, bits );
+        std::size_t ref = table[hash];
+        table[hash] = ( uint32_t ) ( pos + 1 );
+
+        if ( ref == 0 || pos - ( ref - 1 ) > MAX_OFFSET ||
+             read32( src + ref - 1 ) != seq )
+        {
+            // step faster the longer we go without finding a match
+            pos += 1 + ( ( pos - anchor ) >> 6 );
+            continue;
+        }
+
+        ref -= 1;
+
+        // the match may have started before where we found it
+        while ( pos > anchor && ref > 0 && src[ pos - 1 ] == src[ ref - 1 ] )
+        {
+            --pos;
+            --ref;
+        }
+
+        std::size_t length = MIN_MATCH;
+        while ( pos + length < matchLimit && src[ ref + length ] ==
+                src[ pos + length ] )
+        {
+            ++length;
+        }
+
+        pushSequence( oBuf, src + anchor, pos - anchor, pos - ref, length );
+
+        pos += length;
+        anchor = pos;
+
+        if ( oBuf.size() >= iSize )
+        {
+            return false;
+        }
+    }
+
+    pushSequence( oBuf, src + anchor, iSize - anchor, 0, 0 );
+
+    return oBuf.size() < iSize;
+}
+
+//-*****************************************************************************
+void Decompress( const void * iBuf, std::size_t iBufSize,
+                 void * oData, std::size_t iSize )
+{
+    const uint8_t * in = static_cast< const uint8_t * >( iBuf );
+    const uint8_t * inEnd = in + iBufSize;
+
+    if ( iBufSize < 2 )
+    {
+        ABC_THROW( "Compressed data is too small." );
+    }
+
+    std::size_t shuffleSize = *in++;
+
+    uint8_t * dst = static_cast< uint8_t * >( oData );
+    std::vector< uint8_t > shuffled;
+    if ( shuffleSize > 1 )
+    {
+        if ( iSize % shuffleSize != 0 )
+        {
+            ABC_THROW( "Compressed data has an invalid shuffle size." );
+        }
+
+        shuffled.resize( iSize );
+        dst = iSize > 0 ? &shuffled.front() : NULL;
+    }
+
+    std::size_t pos = 0;
+    while ( true )
+    {
+        uint8_t token = *in++;
+
+        std::size_t numLiterals = token >> 4;
+        if ( numLiterals == 15 )
+        {
+            numLiterals += readLength( in, inEnd );
+        }
+
+        if ( numLiterals > ( std::size_t ) ( inEnd - in ) ||
+             numLiterals > iSize - pos )
+        {
+            ABC_THROW( "Compressed data has too many literals." );
+        }
+
+        if ( numLiterals > 0 )
+        {
+            memcpy( dst + pos, in, numLiterals );
+            in += numLiterals;
+            pos += numLiterals;
+        }
+
+        // the last sequence is just literals
+        if ( in == inEnd )
+        {
+            break;
+        }
+
+        if ( inEnd - in < 3 )
+        {
+            ABC_THROW( "Compressed data ended inside of a match." );
+        }
+
+        std::size_t offset = in[0] | ( std::size_t( in[1] ) << 8 );
+        in += 2;
+
+        if ( offset == 0 || offset > pos )
+        {
+            ABC_THROW( "Compressed data has an invalid match offset." );
+        }
+
+        std::size_t length = token & 15;
+        if ( length == 15 )
+        {
+            length += readLength( in, inEnd );
+        }
+        length += MIN_MATCH;
+
+        if ( length > iSize - pos || in == inEnd )
+        {
+            ABC_THROW( "Compressed data has an invalid match length." );
+        }
+
+        uint8_t * matchDst = dst + pos;
+        const uint8_t * matchSrc = matchDst - offset;
+
+        // matches may overlap what they are writing
+        if ( offset >= length )
+        {
+            memcpy( matchDst, matchSrc, length );
+        }
+        else
+        {
+            for ( std::size_t i = 0; i < length; ++i )
+            {
+                matchDst[i] = matchSrc[i];
+            }
+        }
+        pos += length;
+    }
+
+    if ( pos != iSize )
+    {
+        ABC_THROW( "Compressed data didn't expand to the expected size." );
+    }
+
+    if ( shuffleSize > 1 )
+    {
+        uint8_t * out = static_cast< uint8_t * >( oData );
+        std::size_t numElements = iSize / shuffleSize;
+        for ( std::size_t b = 0; b < shuffleSize; ++b )
+        {
+            const uint8_t * src = &shuffled[ b * numElements ];
+            for ( std::size_t i = 0; i < numElements; ++i )
+            {
+                out[ i * shuffleSize + b ] = src[i];
+            }
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,79 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef _Alembic_Util_Compress_h_
+#define _Alembic_Util_Compress_h_
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+#include <Alembic/Util/PlainOldDataType.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// A small and fast LZ77 style codec, in the spirit of LZ4, so that sample
+// data can be compressed without any external dependencies.
+//
+// If iShuffleSize is greater than 1 the data is treated as elements that
+// are iShuffleSize bytes wide, and the bytes are regrouped by their position
+// within each element before compressing.  This usually helps a lot with
+// floating point data.
+//
+// iLevel goes from 0 to 9, higher levels spend more memory looking for
+// matches.
+//
+// Returns false if the data couldn't be made any smaller, in which case
+// oBuf should not be used.
+ALEMBIC_EXPORT bool
+Compress( const void * iData, std::size_t iSize, std::size_t iShuffleSize,
+          int iLevel, std::vector< uint8_t > & oBuf );
+
+//-*****************************************************************************
+// Expands iBuf, which was made by Compress, into exactly iSize bytes at
+// oData.  Throws if iBuf is malformed or doesn't expand to iSize bytes.
+ALEMBIC_EXPORT void
+Decompress( const void * iBuf, std::size_t iBufSize,
+            void * oData, std::size_t iSize );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
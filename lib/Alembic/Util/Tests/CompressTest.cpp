@@ -0,0 +1,136 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2013,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Industrial Light & Magic nor the names of
+// its contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/Compress.h>
+#include <Alembic/Util/Exception.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+namespace AU = Alembic::Util;
+
+//-*****************************************************************************
+void roundTrip( const void * iData, std::size_t iSize,
+                std::size_t iShuffleSize, bool iShouldShrink )
+{
+    for ( int level = 0; level < 10; level += 3 )
+    {
+        std::vector< AU::uint8_t > buf;
+        bool shrunk = AU::Compress( iData, iSize, iShuffleSize, level, buf );
+        TESTING_ASSERT( shrunk == iShouldShrink );
+
+        if ( !shrunk )
+        {
+            continue;
+        }
+
+        TESTING_ASSERT( buf.size() < iSize );
+
+        std::vector< AU::uint8_t > out( iSize );
+        AU::Decompress( &buf.front(), buf.size(), &out.front(), iSize );
+        TESTING_ASSERT( memcmp( &out.front(), iData, iSize ) == 0 );
+
+        // the wrong size is caught
+        std::vector< AU::uint8_t > tooBig( iSize + 1 );
+        TESTING_ASSERT_THROW( AU::Decompress( &buf.front(), buf.size(),
+            &tooBig.front(), iSize + 1 ), AU::Exception );
+        TESTING_ASSERT_THROW( AU::Decompress( &buf.front(), buf.size(),
+            &out.front(), iSize - 1 ), AU::Exception );
+
+        // and so is data that has been cut short
+        TESTING_ASSERT_THROW( AU::Decompress( &buf.front(), buf.size() / 2,
+            &out.front(), iSize ), AU::Exception );
+    }
+}
+
+//-*****************************************************************************
+void testCompress()
+{
+    // nothing to gain from small data
+    char small[] = "potato!";
+    std::vector< AU::uint8_t > buf;
+    TESTING_ASSERT( !AU::Compress( small, sizeof( small ), 0, 9, buf ) );
+
+    // long runs
+    std::vector< AU::int32_t > zeros( 100000, 0 );
+    roundTrip( &zeros.front(), zeros.size() * 4, 0, true );
+    roundTrip( &zeros.front(), zeros.size() * 4, 4, true );
+
+    // repeating patterns, with lots of long literals and long matches
+    std::vector< AU::uint8_t > pattern;
+    for ( std::size_t i = 0; i < 70000; ++i )
+    {
+        pattern.push_back( ( AU::uint8_t )( ( i % 300 ) * 7 ) );
+    }
+    roundTrip( &pattern.front(), pattern.size(), 0, true );
+
+    // noise won't compress
+    std::vector< AU::uint8_t > noise( 50000 );
+    AU::uint32_t seed = 12345;
+    for ( std::size_t i = 0; i < noise.size(); ++i )
+    {
+        seed = seed * 1103515245 + 12345;
+        noise[i] = ( AU::uint8_t )( seed >> 16 );
+    }
+    roundTrip( &noise.front(), noise.size(), 0, false );
+
+    // smoothly varying floats compress much better when shuffled
+    std::vector< AU::float32_t > positions;
+    for ( std::size_t i = 0; i < 30000; ++i )
+    {
+        positions.push_back( 100.0f + ( AU::float32_t ) i * 0.25f );
+    }
+    std::size_t numBytes = positions.size() * sizeof( AU::float32_t );
+    roundTrip( &positions.front(), numBytes, 4, true );
+
+    std::vector< AU::uint8_t > shuffled;
+    TESTING_ASSERT( AU::Compress( &positions.front(), numBytes, 4, 5,
+                                  shuffled ) );
+    if ( AU::Compress( &positions.front(), numBytes, 0, 5, buf ) )
+    {
+        TESTING_ASSERT( shuffled.size() < buf.size() );
+    }
+
+    // garbage
+    std::vector< AU::uint8_t > out( 100 );
+    AU::uint8_t garbage[] = { 0, 0x0f, 1, 2, 3, 4, 5, 6 };
+    TESTING_ASSERT_THROW( AU::Decompress( garbage, sizeof( garbage ),
+                                          &out.front(), 100 ), AU::Exception );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testCompress();
+    return 0;
+}
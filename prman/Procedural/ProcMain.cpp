@@ -327,7 +327,14 @@ Subdivide( RtPointer data, RtFloat detail )
 
     try
     {
+        // many procedurals usually point at the same file, share it
+        // between them
         ::Alembic::AbcCoreFactory::IFactory factory;
+        factory.setUseSharedArchives( true );
+
+        // and each of them walks down from the top again, so keep the
+        // headers of the objects they've been through
+        factory.setOgawaRetainedReaderCount( 4096 );
         IArchive archive = factory.getArchive( args->filename );
 
         IObject root = archive.getTop();